@@ -11,29 +11,39 @@ unsigned long long FPS_Count = 0;
 float FPS_TimeSum = 0.0F;
 fUInt FPS_Actual = 0;
 
-Mesh GenerateRayMesh(fProcMesh& REF_ChunkMesh) {
+// Called by the mesher whenever the raylib buffers are full - Grows them to fit the new vertices
+fBool GrowRayMesh(fVoxelMeshSink& REF_Sink, fUInt IN_Required) {
+    Mesh* MeshPtr = (Mesh*)REF_Sink.UserData;
+
+    fUInt Capacity = REF_Sink.Capacity * 2;
+    if (Capacity < REF_Sink.VertexNum + IN_Required) { Capacity = REF_Sink.VertexNum + IN_Required; }
+
+    MeshPtr->vertices = (float *)MemRealloc(MeshPtr->vertices, Capacity * 3 * sizeof(float));
+    MeshPtr->normals = (float *)MemRealloc(MeshPtr->normals, Capacity * 3 * sizeof(float));
+    MeshPtr->texcoords = (float *)MemRealloc(MeshPtr->texcoords, Capacity * 2 * sizeof(float));
+    if (MeshPtr->vertices == nullptr || MeshPtr->normals == nullptr || MeshPtr->texcoords == nullptr) { return false; }
+
+    REF_Sink.Position.Data = MeshPtr->vertices;
+    REF_Sink.Normal.Data = MeshPtr->normals;
+    REF_Sink.UV.Data = MeshPtr->texcoords;
+    REF_Sink.Capacity = Capacity;
+    return true;
+}
+// The mesher writes straight into the raylib buffers, no fProcMesh in between
+Mesh GenerateRayMesh(fVoxelWorld& REF_World, fUInt IN_ChunkIndex) {
     Mesh Result = {0};
-    fUInt VertNum = REF_ChunkMesh.Vertecies.size();
-
-    Result.vertexCount = VertNum;
-    Result.triangleCount = Result.vertexCount / 3;
-    Result.vertices = (float *)MemAlloc(Result.vertexCount * 3 * sizeof(float));
-    Result.texcoords = (float *)MemAlloc(Result.vertexCount * 2 * sizeof(float));
-    Result.normals = (float *)MemAlloc(Result.vertexCount * 3 * sizeof(float));
 
-    for (fUInt X = 0; X < VertNum; X++) {
-        Result.vertices[(X * 3) + 0] = REF_ChunkMesh.Vertecies[X].X;
-        Result.vertices[(X * 3) + 1] = REF_ChunkMesh.Vertecies[X].Y;
-        Result.vertices[(X * 3) + 2] = REF_ChunkMesh.Vertecies[X].Z;
+    fVoxelMeshSink Sink;
+    Sink.OnFull = GrowRayMesh;
+    Sink.UserData = &Result;
 
-        Result.normals[(X * 3) + 0] = REF_ChunkMesh.Normals[X].X;
-        Result.normals[(X * 3) + 1] = REF_ChunkMesh.Normals[X].Y;
-        Result.normals[(X * 3) + 2] = REF_ChunkMesh.Normals[X].Z;
-
-        Result.texcoords[(X * 2) + 0] = REF_ChunkMesh.UVs[X].X;
-        Result.texcoords[(X * 2) + 1] = REF_ChunkMesh.UVs[X].Y;
+    if (!REF_World.GenerateChunkMesh(IN_ChunkIndex, Sink)) {
+        // TODO: Handle unable to generate chunk mesh.
     }
 
+    Result.vertexCount = Sink.VertexNum;
+    Result.triangleCount = Result.vertexCount / 3;
+
     UploadMesh(&Result, false);
 
     return Result;
@@ -190,7 +200,10 @@ int main() {
                 );
                 BNoise = (BNoise + 1.0F) / 2.0F;
                 float ID = Lerp(0.0F, (float)VList.size() - 1 , BNoise);
-                ChunkPtr->BlockList[Index] = (fUInt)ID;
+
+                // Chunks start as all Air without any BlockList allocated
+                // SetBlock allocates it on the first write
+                ChunkPtr->SetBlock(Index, (fUInt)ID);
             }
         }
     }
@@ -204,14 +217,6 @@ int main() {
     // if we made any changes so we have to manually mark it as changed
     ChunkPtr->isModified = true;
 
-    // After Voxels generated, we can create a mesh for this chunk
-    // mesh generated from the World perspective to enable chunk borders to only
-    // render faces if needed based on the surroundings chunks
-    fProcMesh ChunkMesh;
-    if (!World.GenerateChunkMesh(ChunkIndex, ChunkMesh)) {
-        // TODO: Handle unable to generate chunk mesh.
-    }
-
     // -------------------------------------------------------------------------------------
     // RayLib Stuff
     // -------------------------------------------------------------------------------------
@@ -227,7 +232,10 @@ int main() {
     SetTextureFilter(RayTexture, TEXTURE_FILTER_TRILINEAR);
     GenTextureMipmaps(&RayTexture);
 
-    Mesh RayMesh = GenerateRayMesh(ChunkMesh);
+    // After Voxels generated, we can create a mesh for this chunk
+    // mesh generated from the World perspective to enable chunk borders to only
+    // render faces if needed based on the surroundings chunks
+    Mesh RayMesh = GenerateRayMesh(World, ChunkIndex);
     Model RayModel = LoadModelFromMesh(RayMesh);
     RayModel.materials[0].maps[MATERIAL_MAP_ALBEDO].texture = RayTexture;
 
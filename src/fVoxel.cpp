@@ -5,27 +5,246 @@
 #include <iostream>
 #include <cstring>
 #include <cmath>
+#include <chrono>
+#include <algorithm>
+#include <map>
+#include <array>
+#include <thread>
 
+#if defined(__BMI2__) || defined(__SSE4_1__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+
+// ----------------------------------------------------------------------------------------------------
+// Utility Functions
+
+// Chunk position offset for each F_VOXEL_NEIGHBOUR_* direction
+static const fInt fVoxel_NeighbourOffset[F_VOXEL_NEIGHBOUR_NUM][2] = { {0,-1}, {0,1}, {1,0}, {-1,0} };
+
+// Axes of each face (0-5) used by the ambient occlusion - 0 = X, 1 = Y, 2 = Z
+//      Normal axis, normal sign, U axis, V axis
+static const fInt fVoxel_FaceAxis[6][4] = {
+    {2, -1, 0, 1},  // 0 - Front	Z-
+    {2, 1, 0, 1},   // 1 - Back		Z+
+    {0, 1, 2, 1},   // 2 - Left		X+
+    {0, -1, 2, 1},  // 3 - Right	X-
+    {1, 1, 0, 2},   // 4 - Top		Y+
+    {1, -1, 0, 2}   // 5 - Bottom	Y-
+};
+
+// Return the corner (U sign | V sign << 1) of the face a vertex of a single voxel mesh sits on
+//      @ IN_Axis - Entry of fVoxel_FaceAxis
+//      @ IN_Half - Half of the voxel size on each axis
+static inline fUInt fVoxel_GetFaceCorner(const fProcMesh& REF_Mesh, fUInt IN_Vertex, const fInt* IN_Axis, const fFloat* IN_Half) {
+    fUInt Side[3];
+    if (REF_Mesh.GetisPacked()) {
+        // Position bits of a single voxel are the corner (0 / 1) on each axis
+        const fVoxelPackedVertex& Vertex = REF_Mesh.Packed[IN_Vertex];
+        Side[0] = Vertex.GetX() > 0;
+        Side[1] = Vertex.GetY() > 0;
+        Side[2] = Vertex.GetZ() > 0;
+    } else {
+        const fVector3& Pos = REF_Mesh.Vertecies[IN_Vertex];
+        Side[0] = Pos.X > IN_Half[0];
+        Side[1] = Pos.Y > IN_Half[1];
+        Side[2] = Pos.Z > IN_Half[2];
+    }
+    return Side[IN_Axis[2]] | (Side[IN_Axis[3]] << 1);
+}
+
+// Reorders the 6 vertices of a quad starting at IN_Start - Lists not holding them (e.g. UVs of packed meshes) are skipped
+template<typename T> static inline void fVoxel_ReorderQuad(std::vector<T>& REF_List, fUInt IN_Start, const fUInt* IN_Order) {
+    if (REF_List.size() < IN_Start + 6) { return; }
+
+    T Temp[6];
+    for (fUInt X = 0; X < 6; X++) { Temp[X] = REF_List[IN_Start + IN_Order[X]]; }
+    for (fUInt X = 0; X < 6; X++) { REF_List[IN_Start + X] = Temp[X]; }
+}
+
+// Replaces IN_OldNum elements of REF_List starting at IN_Start with IN_New - Elements after them are moved only if the size changes
+template<typename T> static inline void fVoxel_ReplaceRange(std::vector<T>& REF_List, fUInt IN_Start, fUInt IN_OldNum, const std::vector<T>& IN_New) {
+    fUInt Common = std::min(IN_OldNum, (fUInt)IN_New.size());
+    std::copy(IN_New.begin(), IN_New.begin() + Common, REF_List.begin() + IN_Start);
+
+    if (IN_New.size() > IN_OldNum) { REF_List.insert(REF_List.begin() + IN_Start + Common, IN_New.begin() + Common, IN_New.end()); }
+    else if (IN_New.size() < IN_OldNum) { REF_List.erase(REF_List.begin() + IN_Start + Common, REF_List.begin() + IN_Start + IN_OldNum); }
+}
+
+// Empties every list of REF_Mesh, keeping their memory for the next use
+static inline void fVoxel_ClearMesh(fProcMesh& REF_Mesh) {
+    REF_Mesh.Vertecies.clear();
+    REF_Mesh.Normals.clear();
+    REF_Mesh.UVs.clear();
+    REF_Mesh.AO.clear();
+    REF_Mesh.Colors.clear();
+    REF_Mesh.Packed.clear();
+    REF_Mesh.Indices.clear();
+}
+
+// Number of elements in each list of REF_Mesh - Same order as "fVoxelSpliceEntry::Size"
+static inline void fVoxel_GetMeshSize(const fProcMesh& REF_Mesh, fUInt* OUT_Size) {
+    OUT_Size[0] = REF_Mesh.Vertecies.size();
+    OUT_Size[1] = REF_Mesh.Normals.size();
+    OUT_Size[2] = REF_Mesh.UVs.size();
+    OUT_Size[3] = REF_Mesh.AO.size();
+    OUT_Size[4] = REF_Mesh.Colors.size();
+    OUT_Size[5] = REF_Mesh.Packed.size();
+    OUT_Size[6] = REF_Mesh.Indices.size();
+}
+
+// Interleaves the 2 low bits of X,Y,Z into a 6 bit Morton code - Position within a 4x4x4 brick
+static inline fUInt fVoxel_MortonEncodeBrick(fUInt IN_X, fUInt IN_Y, fUInt IN_Z) {
+#if defined(__BMI2__)
+    return _pdep_u32(IN_X, 0x09) | _pdep_u32(IN_Y, 0x12) | _pdep_u32(IN_Z, 0x24);
+#else
+    return (IN_X & 1) | ((IN_X & 2) << 2) | ((IN_Y & 1) << 1) | ((IN_Y & 2) << 3) | ((IN_Z & 1) << 2) | ((IN_Z & 2) << 4);
+#endif
+}
+
+// Reverse of fVoxel_MortonEncodeBrick
+static inline fVector3ui fVoxel_MortonDecodeBrick(fUInt IN_Code) {
+#if defined(__BMI2__)
+    return { _pext_u32(IN_Code, 0x09), _pext_u32(IN_Code, 0x12), _pext_u32(IN_Code, 0x24) };
+#else
+    return {
+        (IN_Code & 1) | ((IN_Code >> 2) & 2),
+        ((IN_Code >> 1) & 1) | ((IN_Code >> 3) & 2),
+        ((IN_Code >> 2) & 1) | ((IN_Code >> 4) & 2)
+    };
+#endif
+}
 
 // ----------------------------------------------------------------------------------------------------
 // Utility Structures
 
-fProcMesh& fProcMesh::operator+=(const fProcMesh& REF_Other) {
-    fUInt VNum = REF_Other.Vertecies.size();
-    if (VNum > 0) {
-        for (fUInt X = 0; X < VNum; X++) {
-            Vertecies.push_back(REF_Other.Vertecies[X]);
-            Normals.push_back(REF_Other.Normals[X]);
+void fVoxelAxisDivider::Set(fUInt IN_Size) {
+    if (IN_Size == 0) { IN_Size = 1; }
+
+    Size = IN_Size;
+    InvSize = 1.0 / (double)IN_Size;
+
+    Shift = -1;
+    if ((IN_Size & (IN_Size - 1)) == 0) {
+        Shift = 0;
+        while ((1u << Shift) < IN_Size) { Shift++; }
+    }
+}
+void fVoxelAxisDivider::DivMod(const fInt* IN_Values, fInt* OUT_Div, fInt* OUT_Mod, size_t IN_Num) const {
+    size_t X = 0;
+
+    if (Shift >= 0) {
+#if defined(__SSE2__)
+        const __m128i ShiftV = _mm_cvtsi32_si128(Shift);
+        const __m128i MaskV = _mm_set1_epi32(Size - 1);
+        for (; X + 4 <= IN_Num; X += 4) {
+            __m128i V = _mm_loadu_si128((const __m128i*)&IN_Values[X]);
+            _mm_storeu_si128((__m128i*)&OUT_Div[X], _mm_sra_epi32(V, ShiftV));
+            _mm_storeu_si128((__m128i*)&OUT_Mod[X], _mm_and_si128(V, MaskV));
+        }
+#endif
+        for (; X < IN_Num; X++) {
+            OUT_Div[X] = IN_Values[X] >> Shift;
+            OUT_Mod[X] = IN_Values[X] & (Size - 1);
         }
+        return;
+    }
+
+#if defined(__SSE4_1__)
+    // Multiply by the reciprocal in double precision, then fix the result up by one if rounding went the wrong way
+    const __m128d InvV = _mm_set1_pd(InvSize);
+    const __m128i SizeV = _mm_set1_epi32(Size);
+    const __m128i SizeMaxV = _mm_set1_epi32(Size - 1);
+    const __m128i ZeroV = _mm_setzero_si128();
+    for (; X + 4 <= IN_Num; X += 4) {
+        __m128i V = _mm_loadu_si128((const __m128i*)&IN_Values[X]);
+
+        __m128d Lo = _mm_floor_pd(_mm_mul_pd(_mm_cvtepi32_pd(V), InvV));
+        __m128d Hi = _mm_floor_pd(_mm_mul_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(V, _MM_SHUFFLE(1,0,3,2))), InvV));
+        __m128i Q = _mm_unpacklo_epi64(_mm_cvttpd_epi32(Lo), _mm_cvttpd_epi32(Hi));
+        __m128i R = _mm_sub_epi32(V, _mm_mullo_epi32(Q, SizeV));
+
+        __m128i Under = _mm_cmplt_epi32(R, ZeroV);
+        Q = _mm_add_epi32(Q, Under);
+        R = _mm_add_epi32(R, _mm_and_si128(Under, SizeV));
+
+        __m128i Over = _mm_cmpgt_epi32(R, SizeMaxV);
+        Q = _mm_sub_epi32(Q, Over);
+        R = _mm_sub_epi32(R, _mm_and_si128(Over, SizeV));
+
+        _mm_storeu_si128((__m128i*)&OUT_Div[X], Q);
+        _mm_storeu_si128((__m128i*)&OUT_Mod[X], R);
     }
+#endif
+    for (; X < IN_Num; X++) {
+        OUT_Div[X] = fVoxelFloorDiv(IN_Values[X], Size);
+        OUT_Mod[X] = IN_Values[X] - (OUT_Div[X] * Size);
+    }
+}
 
-    fUInt UNum = REF_Other.UVs.size();
-    if (UNum > 0) {
-        for(fUInt X = 0; X < UNum; X++) { UVs.push_back(REF_Other.UVs[X]); }
+fProcMesh& fProcMesh::operator+=(const fProcMesh& REF_Other) {
+    if (REF_Other.Indices.size() > 0) {
+        fUInt Offset = GetVertexNum();
+        fUInt Start = Indices.size();
+        Indices.insert(Indices.end(), REF_Other.Indices.begin(), REF_Other.Indices.end());
+        for (fUInt X = Start; X < Indices.size(); X++) { Indices[X] += Offset; }
     }
 
+    Vertecies.insert(Vertecies.end(), REF_Other.Vertecies.begin(), REF_Other.Vertecies.end());
+    Normals.insert(Normals.end(), REF_Other.Normals.begin(), REF_Other.Normals.end());
+    UVs.insert(UVs.end(), REF_Other.UVs.begin(), REF_Other.UVs.end());
+    AO.insert(AO.end(), REF_Other.AO.begin(), REF_Other.AO.end());
+    Colors.insert(Colors.end(), REF_Other.Colors.begin(), REF_Other.Colors.end());
+    Packed.insert(Packed.end(), REF_Other.Packed.begin(), REF_Other.Packed.end());
+
     return *this;
 }
+fProcMesh fProcMesh::GetIndexed() const {
+    fProcMesh Result;
+    fBool isUVs = UVs.size() == Vertecies.size();
+    fBool isAO = AO.size() == Vertecies.size();
+    fBool isColors = Colors.size() == Vertecies.size();
+
+    // Position, Normal, UV, AO, Color
+    std::map<std::array<fFloat, 13>, fUInt> VertexMap;
+    fUInt Num = GetisIndexed() ? Indices.size() : Vertecies.size();
+    for (fUInt X = 0; X < Num; X++) {
+        fUInt Src = GetisIndexed() ? Indices[X] : X;
+
+        std::array<fFloat, 13> Key = {
+            Vertecies[Src].X, Vertecies[Src].Y, Vertecies[Src].Z,
+            Normals[Src].X, Normals[Src].Y, Normals[Src].Z,
+            isUVs ? UVs[Src].X : 0.0F, isUVs ? UVs[Src].Y : 0.0F,
+            isAO ? (fFloat)AO[Src] : 0.0F,
+            isColors ? (fFloat)Colors[Src].R : 0.0F, isColors ? (fFloat)Colors[Src].G : 0.0F,
+            isColors ? (fFloat)Colors[Src].B : 0.0F, isColors ? (fFloat)Colors[Src].A : 0.0F
+        };
+
+        std::map<std::array<fFloat, 13>, fUInt>::iterator It = VertexMap.find(Key);
+        if (It != VertexMap.end()) {
+            Result.Indices.push_back(It->second);
+            continue;
+        }
+
+        fUInt Index = Result.Vertecies.size();
+        VertexMap[Key] = Index;
+        Result.Vertecies.push_back(Vertecies[Src]);
+        Result.Normals.push_back(Normals[Src]);
+        if (isUVs) { Result.UVs.push_back(UVs[Src]); }
+        if (isAO) { Result.AO.push_back(AO[Src]); }
+        if (isColors) { Result.Colors.push_back(Colors[Src]); }
+        Result.Indices.push_back(Index);
+    }
+
+    return Result;
+}
 
 // ----------------------------------------------------------------------------------------------------
 // fVoxel Internal Defs
@@ -60,6 +279,8 @@ fBool fVoxelRegionData::LoadHeader() {
         EntryList[X].ReadFromBuffer(IntDataPtr, Pos);
     }
 
+    WorldPtr->DeAllocator(DataPtr);
+
     return true;
 }
 fBool fVoxelRegionData::SaveHeader() {
@@ -91,6 +312,7 @@ fBool fVoxelRegionData::SaveHeader() {
 }
 
 fUInt fVoxelRegionData::SaveNewEntry(fVoxelRegionEntry& REF_Entry, fUChar* IN_DataPtr, fUInt IN_DataSize) {
+    fUInt Index = EntryList.size();
     EntryList.push_back(REF_Entry);
     EOF_Offset += REF_Entry.Size;
 
@@ -101,7 +323,8 @@ fUInt fVoxelRegionData::SaveNewEntry(fVoxelRegionEntry& REF_Entry, fUChar* IN_Da
         WorldPtr->IO_CreateEmptyFile(FileName);
     }
 
-    return WorldPtr->IO_AppendBinaryData(FileName, IN_DataPtr, IN_DataSize, F_LONG_MAX);
+    if (!WorldPtr->IO_AppendBinaryData(FileName, IN_DataPtr, IN_DataSize, F_LONG_MAX)) { return F_UINT_MAX; }
+    return Index;
 }
 fBool fVoxelRegionData::OverrideEntry(fUInt IN_EntryIndex, fVoxelRegionEntry& REF_Entry, fUChar* IN_DataPtr, fUInt IN_DataSize) {
     // Temporarily save previous Entry
@@ -114,9 +337,8 @@ fBool fVoxelRegionData::OverrideEntry(fUInt IN_EntryIndex, fVoxelRegionEntry& RE
     fLong Diff = REF_Entry.Size - TempEntry.Size;
     fUInt Num = EntryList.size();
     fUInt X = IN_EntryIndex + 1;
-    if (X < Num - 1) {
-        while (X < Num) { EntryList[X].Offset += Diff; X++; }
-    }
+    while (X < Num) { EntryList[X].Offset += Diff; X++; }
+    EOF_Offset += Diff;
 
     //
     SaveHeader();
@@ -169,15 +391,128 @@ fUInt fVoxelRegionData::GetChunkEntryIndex(fInt IN_PosX, fInt IN_PosZ) {
 
     return F_UINT_MAX;
 }
+// ----------------------------------------------------------------------------
+// fVoxelBlockArena
+
+fBool fVoxelBlockArena::Reserve(fLong IN_SlotSize, fUInt IN_SlotCount, fBool IN_isHugePages, fMemoryAllocator IN_Allocator) {
+    if (RegionPtr != nullptr) { return false; }
+    if (IN_SlotSize <= 0 || IN_SlotCount == 0) { return false; }
+
+    Stats = fVoxelArenaStats();
+
+    // Round slots up to page size so each slot can be given back to the OS on its own
+    fLong PageSize = 4096;
+#if defined(__linux__)
+    PageSize = sysconf(_SC_PAGESIZE);
+#endif
+    SlotSize = ((IN_SlotSize + PageSize - 1) / PageSize) * PageSize;
+    SlotCount = IN_SlotCount;
+    fLong RegionSize = SlotSize * SlotCount;
+
+#if defined(__linux__)
+    void* Ptr = MAP_FAILED;
+    if (IN_isHugePages) {
+        // Explicit huge pages needs to be reserved by the system (vm.nr_hugepages), so this can fail
+        // No MAP_NORESERVE here - mmap must fail now rather than SIGBUS on first touch
+        const fLong HugePageSize = 2 * 1024 * 1024;
+        fLong HugeSize = ((RegionSize + HugePageSize - 1) / HugePageSize) * HugePageSize;
+        Ptr = mmap(nullptr, HugeSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (Ptr != MAP_FAILED) {
+            RegionSize = HugeSize;
+            Stats.isHugePages = true;
+        }
+    }
+    if (Ptr == MAP_FAILED) {
+        // Pages are only commited on first touch, so reserving for the worst case is cheap
+        Ptr = mmap(nullptr, RegionSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (Ptr != MAP_FAILED && IN_isHugePages) {
+            Stats.isTransparentHugePages = madvise(Ptr, RegionSize, MADV_HUGEPAGE) == 0;
+        }
+    }
+    if (Ptr != MAP_FAILED) {
+        RegionPtr = (fUChar*)Ptr;
+        isMapped = true;
+    }
+#endif
+
+    if (RegionPtr == nullptr) {
+        RegionPtr = (fUChar*)IN_Allocator(RegionSize);
+        isMapped = false;
+        if (RegionPtr == nullptr) { return false; }
+    }
+
+    // Push in reverse so slots are handed out from the start of the region
+    FreeSlotList.clear();
+    FreeSlotList.reserve(SlotCount);
+    for (fUInt X = SlotCount; X > 0; X--) { FreeSlotList.push_back(X - 1); }
+
+    Stats.ReservedBytes = RegionSize;
+    Stats.SlotSize = SlotSize;
+    Stats.SlotCount = SlotCount;
+    return true;
+}
+void fVoxelBlockArena::Release(fMemoryDeAllocator IN_DeAllocator) {
+    if (RegionPtr == nullptr) { return; }
+
+#if defined(__linux__)
+    if (isMapped) { munmap(RegionPtr, Stats.ReservedBytes); }
+#endif
+    if (!isMapped) { IN_DeAllocator(RegionPtr); }
+
+    RegionPtr = nullptr;
+    SlotSize = 0;
+    SlotCount = 0;
+    FreeSlotList.clear();
+    Stats = fVoxelArenaStats();
+}
+void* fVoxelBlockArena::Alloc() {
+    if (FreeSlotList.size() == 0) { return nullptr; }
+
+    fUInt Slot = FreeSlotList.back();
+    FreeSlotList.pop_back();
+
+    Stats.SlotsInUse++;
+    if (Stats.SlotsInUse > Stats.PeakSlotsInUse) { Stats.PeakSlotsInUse = Stats.SlotsInUse; }
+
+    return RegionPtr + (Slot * SlotSize);
+}
+fBool fVoxelBlockArena::Free(void* IN_Ptr) {
+    if (!isOwned(IN_Ptr)) { return false; }
+
+    fUInt Slot = ((fUChar*)IN_Ptr - RegionPtr) / SlotSize;
+
+#if defined(__linux__)
+    // Slots are only freed once idle - give the physical pages back, they are commited again on next use
+    if (isMapped && !Stats.isHugePages) { madvise(IN_Ptr, SlotSize, MADV_DONTNEED); }
+#endif
+
+    FreeSlotList.push_back(Slot);
+    Stats.SlotsInUse--;
+    return true;
+}
+fBool fVoxelBlockArena::isOwned(void* IN_Ptr) {
+    if (RegionPtr == nullptr) { return false; }
+
+    fUChar* Ptr = (fUChar*)IN_Ptr;
+    return Ptr >= RegionPtr && Ptr < RegionPtr + (SlotSize * SlotCount);
+}
+
 // ----------------------------------------------------------------------------
 // Chunk
 
 fBool fVoxelChunk::_Internal_CompressData(std::vector<fVector2ui>& REF_Data) {
     REF_Data.clear();
+    fLong BlocksPerChunk = WorldPtr->Get_BlocksPerChunk();
+
+    // Uniform chunk is a single run
+    if (!isAllocated) {
+        REF_Data.push_back({(fUInt)BlocksPerChunk, UniformBlock});
+        return true;
+    }
+
     REF_Data.push_back({1,BlockList[0]});
     fUInt Index = 0;
 
-    fLong BlocksPerChunk = WorldPtr->Get_BlocksPerChunk();
     for (fLong X = 1; X < BlocksPerChunk; X++) {
         if (BlockList[X] == REF_Data[Index].Y) {
             REF_Data[Index].X++;
@@ -193,6 +528,20 @@ fBool fVoxelChunk::_Internal_CompressData(std::vector<fVector2ui>& REF_Data) {
 fBool fVoxelChunk::_Internal_DeCompressData(std::vector<fVector2ui>& REF_Data) {
     fUInt Num = REF_Data.size();
     fUInt Index = 0;
+
+    // A single run covering the whole chunk does not need a BlockList
+    if (Num == 1 && REF_Data[0].X == WorldPtr->Get_BlocksPerChunk()) {
+        if (isAllocated) {
+            WorldPtr->_Internal_ReleaseBlockList(BlockList);
+            BlockList = nullptr;
+            isAllocated = false;
+        }
+        UniformBlock = REF_Data[0].Y;
+        return true;
+    }
+
+    if (!_Internal_AllocateBlockList()) { return false; }
+
     for (fUInt X = 0; X < Num; X++) {
         for (fUInt Y = 0; Y < REF_Data[X].X; Y++) {
             BlockList[Index++] = REF_Data[X].Y;
@@ -212,15 +561,8 @@ fBool fVoxelChunk::_Internal_Validate(std::string IN_What) {
     }
     return true;
 }
-fUInt fVoxelChunk::GetVoxelIndex(fUInt IN_X, fUInt IN_Y, fUInt IN_Z) {
-    fVector3ui ChunkSize = WorldPtr->GetChunkSize();
-    // X > Z > Y
-
-    if (IN_X >= ChunkSize.X) { return F_UINT_MAX; }
-    if (IN_Y >= ChunkSize.Y) { return F_UINT_MAX; }
-    if (IN_Z >= ChunkSize.Z) { return F_UINT_MAX; }
-
-    return (IN_Y * (ChunkSize.Z * ChunkSize.X)) + (IN_Z * ChunkSize.X) + IN_X;
+fVector3ui fVoxelChunk::GetVoxelPosition(fUInt IN_Index) {
+    return WorldPtr->_Internal_GetVoxelPosition(IN_Index);
 }
 fBool fVoxelChunk::SaveChunkData() {
     if (!_Internal_Validate("SaveChunkData")) { return false; }
@@ -237,7 +579,8 @@ fBool fVoxelChunk::SaveChunkData() {
         Entry.Offset = RegionPtr->EOF_Offset;
         Entry.Size = DataSize;
 
-        Result = RegionEntryIndex = RegionPtr->SaveNewEntry(Entry, (fUChar*)C_Data.data(), DataSize);
+        RegionEntryIndex = RegionPtr->SaveNewEntry(Entry, (fUChar*)C_Data.data(), DataSize);
+        Result = RegionEntryIndex < F_UINT_MAX;
     }
     else {
         fVoxelRegionEntry Entry = RegionPtr->EntryList[RegionEntryIndex];
@@ -246,7 +589,10 @@ fBool fVoxelChunk::SaveChunkData() {
         Result = RegionPtr->OverrideEntry(RegionEntryIndex, Entry, (fUChar*)C_Data.data(), DataSize);
     }
 
-    if (Result) {isModified = false;}
+    if (Result) {
+        isModified = false;
+        for (fUInt X = 0; X < SectionList.size(); X++) { SectionList[X].isModified = false; }
+    }
     return Result;
 }
 fBool fVoxelChunk::LoadChunkData() {
@@ -255,25 +601,120 @@ fBool fVoxelChunk::LoadChunkData() {
     fVoxelRegionEntry& E = RegionPtr->EntryList[RegionEntryIndex];
     fUChar* Buffer = (fUChar*)WorldPtr->Allocator(sizeof(fUChar) * E.Size);
     fBool Result = RegionPtr->LoadEntry(RegionEntryIndex, Buffer);
+    if (!Result) {
+        WorldPtr->DeAllocator(Buffer);
+        return false;
+    }
 
     std::vector<fVector2ui> C_Data;
     fUInt C_Size = E.Size / 8;
     C_Data.resize(C_Size, {0,0});
     memcpy(C_Data.data(), Buffer, E.Size);
+    WorldPtr->DeAllocator(Buffer);
+
     return _Internal_DeCompressData(C_Data);
 }
+fBool fVoxelChunk::_Internal_AllocateBlockList() {
+    if (isAllocated) { return true; }
+
+    BlockList = WorldPtr->_Internal_AcquireBlockList();
+    if (BlockList == nullptr) {
+        WorldPtr->Log(F_LOG_SEV_ERROR,"FVoxelChunk","Unable to allocate BlockList for Chunk [" + std::to_string(PosX) + "," + std::to_string(PosZ) + "]");
+        return false;
+    }
+
+    // Acquired BlockList is filled with F_UINT_MAX
+    if (UniformBlock != F_UINT_MAX) {
+        std::fill_n(BlockList, WorldPtr->Get_BlocksPerChunk(), UniformBlock);
+    }
+
+    isAllocated = true;
+    return true;
+}
+fUInt fVoxelChunk::GetTicketLevel() {
+    for (fUInt X = F_CHUNK_TICKET_LEVEL_NUM; X > 0; X--) {
+        if (TicketCount[X - 1] > 0) { return X - 1; }
+    }
+    return F_UINT_MAX;
+}
 
 
 // ----------------------------------------------------------------------------
 // Chunk
+std::string fVoxelLocalPos::ToString() {
+    return "[Chunk: " + std::to_string(ChunkX) + "," + std::to_string(ChunkZ) + " Local: " + std::to_string(LocalX) + "," + std::to_string(LocalY) + "," + std::to_string(LocalZ) + "]";
+}
 fVoxelBlock::fVoxelBlock(fUInt IN_UID, std::string IN_Name, fVector2ui IN_Texture, fUChar IN_Flags) {
     UID = IN_UID;
     Name = IN_Name;
     Texture = IN_Texture;
+    TextureTop = IN_Texture;
+    TextureBottom = IN_Texture;
+    Flags = IN_Flags;
+}
+fVoxelBlock::fVoxelBlock(fUInt IN_UID, std::string IN_Name, fVector2ui IN_TextureSide, fVector2ui IN_TextureTop, fVector2ui IN_TextureBottom, fUChar IN_Flags) {
+    UID = IN_UID;
+    Name = IN_Name;
+    Texture = IN_TextureSide;
+    TextureTop = IN_TextureTop;
+    TextureBottom = IN_TextureBottom;
     Flags = IN_Flags;
 }
 
 
+// ----------------------------------------------------------------------------
+// fVoxelBlockRegistry
+
+void fVoxelBlockRegistry::Build(const std::vector<fVoxelBlock>& REF_BlockList, fFloat IN_TextureStepX, fFloat IN_TextureStepY) {
+    SlotNum = REF_BlockList.size() + 1;
+
+    // Slot 0 (Air) stays all zero
+    FlagList.assign(SlotNum, 0);
+    SolidList.assign(SlotNum, 0);
+    OpaqueList.assign(SlotNum, 0);
+    SelfCullList.assign(SlotNum, 0);
+    PassList.assign(SlotNum, F_VOXEL_PASS_OPAQUE);
+    LightList.assign(SlotNum, 0);
+    UVRectList.assign(SlotNum * F_VOXEL_UV_TABLE_STRIDE, fVoxelUVRect());
+    TileList.assign(SlotNum * F_VOXEL_UV_TABLE_STRIDE, 0);
+    NameMap.clear();
+
+    for (fUInt X = 0; X < REF_BlockList.size(); X++) {
+        const fVoxelBlock& BlockRef = REF_BlockList[X];
+        fUInt S = GetSlot(X);
+
+        FlagList[S] = BlockRef.Flags;
+        SolidList[S] = (BlockRef.Flags & F_VOXEL_BLOCK_NON_SOLID) == 0;
+        OpaqueList[S] = (BlockRef.Flags & (F_VOXEL_BLOCK_TRANSPARENT | F_VOXEL_BLOCK_CUTOUT | F_VOXEL_BLOCK_TRANSLUCENT)) == 0;
+
+        // Translucent wins over Cutout
+        if (BlockRef.Flags & F_VOXEL_BLOCK_CUTOUT) { PassList[S] = F_VOXEL_PASS_CUTOUT; }
+        if (BlockRef.Flags & F_VOXEL_BLOCK_TRANSLUCENT) { PassList[S] = F_VOXEL_PASS_TRANSLUCENT; }
+
+        // Faces between 2 blocks of the same ID are hidden (glass, water), except for cutout blocks (leaves)
+        SelfCullList[S] = PassList[S] != F_VOXEL_PASS_CUTOUT;
+        LightList[S] = (BlockRef.Flags & F_VOXEL_BLOCK_LIGHT_MASK) >> F_VOXEL_BLOCK_LIGHT_SHIFT;
+        if (BlockRef.Name.length() > 0) { NameMap[BlockRef.Name] = X; }
+
+        for (fUInt F = 0; F < 7; F++) {
+            fVector2ui Tile = BlockRef.Texture;
+            if (F == 4) { Tile = BlockRef.TextureTop; }
+            if (F == 5) { Tile = BlockRef.TextureBottom; }
+
+            fVoxelUVRect& Rect = UVRectList[(S * F_VOXEL_UV_TABLE_STRIDE) + F];
+            Rect.U = Tile.X * IN_TextureStepX;
+            Rect.V = Tile.Y * IN_TextureStepY;
+            Rect.StepU = IN_TextureStepX;
+            Rect.StepV = IN_TextureStepY;
+
+            TileList[(S * F_VOXEL_UV_TABLE_STRIDE) + F] = fVoxelPackedVertex::PackTile(Tile.X, Tile.Y);
+        }
+    }
+}
+fUInt fVoxelBlockRegistry::GetBlockID(const std::string& REF_Name) const {
+    std::unordered_map<std::string, fUInt>::const_iterator It = NameMap.find(REF_Name);
+    return It == NameMap.end() ? F_UINT_MAX : It->second;
+}
 
 
 // ----------------------------------------------------------------------------------------------------
@@ -516,13 +957,61 @@ std::string fVoxelWorld::GetRegionDataFile(fInt IN_RX, fInt IN_RZ) {
 
 
 void fVoxelWorld::_Internal_Init() {
-    ChunksPerWorld = WorldSize_X * WorldSize_Z;
+    _Internal_UpdateDividers();
+
     BlocksPerChunk = ChunkSize_X * ChunkSize_Y * ChunkSize_Z;
+    SectionsPerChunk = (ChunkSize_Y + F_VOXEL_SECTION_SIZE_Y - 1) / F_VOXEL_SECTION_SIZE_Y;
+    MeshPad_X = ChunkSize_X + 2;
+    MeshPad_Z = ChunkSize_Z + 2;
+    LayoutBricks_X = 0;
+    LayoutBricks_Z = 0;
+
+    if (VoxelLayout == F_VOXEL_LAYOUT_BRICK) {
+        // Pad the chunk to whole bricks - padding voxels are never addressed and stay F_UINT_MAX
+        LayoutBricks_X = (ChunkSize_X + F_VOXEL_BRICK_SIZE - 1) >> F_VOXEL_BRICK_SHIFT;
+        LayoutBricks_Z = (ChunkSize_Z + F_VOXEL_BRICK_SIZE - 1) >> F_VOXEL_BRICK_SHIFT;
+        fUInt Bricks_Y = (ChunkSize_Y + F_VOXEL_BRICK_SIZE - 1) >> F_VOXEL_BRICK_SHIFT;
+        BlocksPerChunk = (fLong)LayoutBricks_X * LayoutBricks_Z * Bricks_Y * F_VOXEL_BRICK_VOLUME;
+    }
+
+    ChunkList.clear();
+    ChunkSlabList.clear();
+    ChunkMap.clear();
+    LastChunkIndex = F_UINT_MAX;
+    ChunksPerWorld = 0;
+    SpliceOwnerMap.clear();
 
-    ChunkList.resize(ChunksPerWorld, fVoxelChunk(this));
+    fUInt MinChunks = _Internal_GetPoolMinChunks();
+    while (ChunksPerWorld < MinChunks) {
+        if (!_Internal_GrowChunkPool()) { break; }
+    }
+
+    if (BlockArena_isEnabled) {
+        fUInt SlotCount = BlockArena_SlotCount;
+        if (SlotCount == 0) { SlotCount = _Internal_GetPoolMaxChunks(); }
+
+        if (BlockArena.Reserve(sizeof(fUInt) * BlocksPerChunk, SlotCount, BlockArena_isHugePages, Allocator)) {
+            fVoxelArenaStats& Stats = BlockArena.GetStats();
+            Log(F_LOG_SEV_DEBUG,"FVoxelWorld","BlockList arena reserved [" + std::to_string(Stats.ReservedBytes) + "] bytes for [" + std::to_string(Stats.SlotCount) + "] BlockLists");
+        }
+        else {
+            Log(F_LOG_SEV_WARNING,"FVoxelWorld","Unable to reserve BlockList arena. BlockLists will be allocated with Allocator.");
+        }
+    }
 
     _Internal_CalculateTempVerts();
 }
+void fVoxelWorld::_Internal_UpdateDividers() {
+    ChunkDiv_X.Set(ChunkSize_X);
+    ChunkDiv_Z.Set(ChunkSize_Z);
+    RegionDiv_X.Set(RegionSize_X);
+    RegionDiv_Z.Set(RegionSize_Z);
+
+    // Linear voxel index only folds to shifts if both X and Z are powers of 2
+    fBool isShift = ChunkDiv_X.Shift >= 0 && ChunkDiv_Z.Shift >= 0;
+    IndexShift_Z = isShift ? ChunkDiv_X.Shift : -1;
+    IndexShift_Y = isShift ? ChunkDiv_X.Shift + ChunkDiv_Z.Shift : -1;
+}
 void fVoxelWorld::_Internal_CalculateTempVerts() {
     TempVertNum_Front = VoxelMesh[0].Vertecies.size();
     TempVertNum_Back = VoxelMesh[1].Vertecies.size();
@@ -531,6 +1020,44 @@ void fVoxelWorld::_Internal_CalculateTempVerts() {
     TempVertNum_Top = VoxelMesh[4].Vertecies.size();
     TempVertNum_Bottom = VoxelMesh[5].Vertecies.size();
     TempVertNum_Always = VoxelMesh[6].Vertecies.size();
+
+    for (fUInt X = 0; X < 7; X++) {
+        VoxelMeshIndexed[X] = VoxelMesh[X].GetIndexed();
+        VoxelMeshPacked[X] = _Internal_PackFaceMesh(VoxelMesh[X], X);
+        VoxelMeshPackedIndexed[X] = _Internal_PackFaceMesh(VoxelMeshIndexed[X], X);
+    }
+}
+fProcMesh fVoxelWorld::_Internal_PackFaceMesh(const fProcMesh& REF_Mesh, fUInt IN_Face) {
+    fProcMesh Result;
+    Result.Indices = REF_Mesh.Indices;
+
+    fBool isUVs = REF_Mesh.UVs.size() == REF_Mesh.Vertecies.size();
+    for (fUInt X = 0; X < REF_Mesh.Vertecies.size(); X++) {
+        const fVector3& Pos = REF_Mesh.Vertecies[X];
+        fUInt CornerX = (fUInt)std::max(0.0F, std::round(Pos.X / VoxelSize_X));
+        fUInt CornerY = (fUInt)std::max(0.0F, std::round(Pos.Y / VoxelSize_Y));
+        fUInt CornerZ = (fUInt)std::max(0.0F, std::round(Pos.Z / VoxelSize_Z));
+
+        fUInt Corner = 0;
+        if (isUVs && REF_Mesh.UVs[X].X > 0.5F) { Corner |= 1; }
+        if (isUVs && REF_Mesh.UVs[X].Y > 0.5F) { Corner |= 2; }
+
+        fVoxelPackedVertex Vertex;
+        Vertex.A = fVoxelPackedVertex::PackPosition(CornerX, CornerY, CornerZ);
+        Vertex.B = IN_Face | (Corner << 3);
+        Result.Packed.push_back(Vertex);
+    }
+
+    return Result;
+}
+fBool fVoxelWorld::_Internal_ValidateMeshFormat() {
+    if (!isPackedMesh) { return true; }
+
+    if (ChunkSize_X > F_VOXEL_PACKED_MAX_X || ChunkSize_Y > F_VOXEL_PACKED_MAX_Y || ChunkSize_Z > F_VOXEL_PACKED_MAX_Z) {
+        Log(F_LOG_SEV_ERROR,"FVoxelWorld","Unable to generate chunk mesh. Chunk size is too large for packed vertices.");
+        return false;
+    }
+    return true;
 }
 fBool fVoxelWorld::_Internal_SaveWorldProp() {
     fUInt Properties[7] = {
@@ -546,14 +1073,22 @@ fBool fVoxelWorld::_Internal_SaveWorldProp() {
     std::string FinalString = WorldFolderName + "#" + RegionFolderName + "#" + WolrdFileName + "#" + RegionHeaderName + "#" + RegionDataName;
     fUInt FinalSize = FinalString.length();
 
+    // Properties added later are stored after the names
+    // Files saved before they existed ends at the terminating 0 and loads the defaults
+    fUInt ExtProperties[1] = {
+        VoxelLayout
+    };
+
     fLong BufferSize = 7 * sizeof(fUInt);
     BufferSize += FinalSize + 1;            // +1 for the terminateing 0
+    BufferSize += 1 * sizeof(fUInt);
 
     fUChar* Buffer = (fUChar*)Allocator(BufferSize);
 
     memcpy(Buffer, (fUChar*)&Properties[0], 7 * sizeof(fUInt));
     strcpy((char*)&Buffer[7 * sizeof(fUInt)], &FinalString[0]);
-    Buffer[BufferSize - 1] = 0;
+    Buffer[(7 * sizeof(fUInt)) + FinalSize] = 0;
+    memcpy(&Buffer[(7 * sizeof(fUInt)) + FinalSize + 1], (fUChar*)&ExtProperties[0], 1 * sizeof(fUInt));
 
     std::string FileName = GetWorldFile();
     IO_SaveBinaryData(FileName, Buffer, BufferSize);
@@ -599,6 +1134,17 @@ fBool fVoxelWorld::_Internal_LoadWorldProp(std::string IN_FileName) {
     RegionHeaderName = StrList[3];
     RegionDataName = StrList[4];
 
+    // Properties after the names - see "_Internal_SaveWorldProp()"
+    fUInt ExtProperties[1] = {
+        F_VOXEL_LAYOUT_LINEAR
+    };
+    fLong ExtOffset = (7 * sizeof(fUInt)) + TempSize + 1;
+    if (BufferSize >= ExtOffset + (fLong)(1 * sizeof(fUInt))) {
+        memcpy(&ExtProperties[0], &Buffer[ExtOffset], 1 * sizeof(fUInt));
+    }
+
+    VoxelLayout = ExtProperties[0];
+
     DeAllocator(Buffer);
 
     return false;
@@ -609,12 +1155,7 @@ fVector2i fVoxelWorld::_Internal_GetRegionPos(fInt IN_PosX, fInt IN_PosZ) {
     if (RegionSize_X == 0) { throw 0; }
     if (RegionSize_Z == 0) { throw 0; }
 
-    fInt X = IN_PosX / RegionSize_X;
-    fInt Z = IN_PosZ / RegionSize_Z;
-    if (IN_PosX < 0) { X--; }
-    if (IN_PosZ < 0) { Z--; }
-
-    return {X,Z};
+    return {RegionDiv_X.Div(IN_PosX), RegionDiv_Z.Div(IN_PosZ)};
 }
 fUInt fVoxelWorld::_Internal_GetRegionIndex(fInt IN_PosX, fInt IN_PosZ) {
     fUInt Num = RegionList.size();
@@ -651,104 +1192,316 @@ fUInt fVoxelWorld::_Internal_CreateRegion(fInt IN_PosX, fInt IN_PosZ) {
 }
 
 fUInt fVoxelWorld::_Internal_GetChunkIndex(fInt IN_X, fInt IN_Z) {
-    for (fLong X = 0; X < ChunksPerWorld; X++) {
-        if (ChunkList[X].isExist == false) { continue; }
-        if (ChunkList[X].PosX != IN_X) { continue; }
-        if (ChunkList[X].PosZ != IN_Z) { continue; }
-        return X;
+    if (LastChunkIndex < ChunksPerWorld) {
+        fVoxelChunk* ChunkPtr = ChunkList[LastChunkIndex];
+        if (ChunkPtr->isExist && ChunkPtr->PosX == IN_X && ChunkPtr->PosZ == IN_Z) { return LastChunkIndex; }
     }
-    return F_UINT_MAX;
+
+    std::unordered_map<fLong, fUInt>::iterator It = ChunkMap.find(_Internal_GetChunkKey(IN_X, IN_Z));
+    if (It == ChunkMap.end()) { return F_UINT_MAX; }
+
+    LastChunkIndex = It->second;
+    return It->second;
+}
+fVoxelChunk* fVoxelWorld::_Internal_FindChunk(fInt IN_X, fInt IN_Z) const {
+    std::unordered_map<fLong, fUInt>::const_iterator It = ChunkMap.find(_Internal_GetChunkKey(IN_X, IN_Z));
+    if (It == ChunkMap.end()) { return nullptr; }
+
+    return ChunkList[It->second];
+}
+fBool fVoxelWorld::_Internal_SetChunkVoxel(fUInt IN_ChunkIndex, fInt IN_LocalX, fInt IN_LocalY, fInt IN_LocalZ, fUInt IN_BlockID) {
+    fVoxelChunk* ChunkPtr = ChunkList[IN_ChunkIndex];
+    fUInt Index = ChunkPtr->GetVoxelIndex(IN_LocalX, IN_LocalY, IN_LocalZ);
+
+    // Nothing changes - nothing to record
+    fUInt OldID = ChunkPtr->GetBlock(Index);
+    if (OldID == IN_BlockID) { return true; }
+
+    if (!ChunkPtr->_Internal_SetBlock(Index, IN_BlockID)) { return false; }
+    _Internal_CountVoxel(ChunkPtr, IN_LocalX, IN_LocalY, IN_LocalZ, OldID, IN_BlockID);
+
+    _Internal_MarkDirty(IN_ChunkIndex, IN_LocalX, IN_LocalY, IN_LocalZ, IN_LocalX, IN_LocalY, IN_LocalZ);
+    return true;
+}
+void fVoxelWorld::_Internal_MarkDirty(fUInt IN_ChunkIndex, fInt IN_MinX, fInt IN_MinY, fInt IN_MinZ, fInt IN_MaxX, fInt IN_MaxY, fInt IN_MaxZ) {
+    fVoxelChunk* ChunkPtr = ChunkList[IN_ChunkIndex];
+    ChunkPtr->isModified = true;
+    ChunkPtr->isMeshDirty = true;
+
+    // Voxels on a section border changes the visible faces of the section next to it
+    fInt MinSection = IN_MinY / F_VOXEL_SECTION_SIZE_Y;
+    fInt MaxSection = IN_MaxY / F_VOXEL_SECTION_SIZE_Y;
+    for (fInt X = MinSection; X <= MaxSection; X++) { ChunkPtr->SectionList[X].isModified = true; }
+
+    fInt MinMeshSection = (IN_MinY - 1) / F_VOXEL_SECTION_SIZE_Y;
+    fInt MaxMeshSection = (IN_MaxY + 1) / F_VOXEL_SECTION_SIZE_Y;
+    if (IN_MinY == 0) { MinMeshSection = 0; }
+    if (MaxMeshSection >= (fInt)SectionsPerChunk) { MaxMeshSection = SectionsPerChunk - 1; }
+    for (fInt X = MinMeshSection; X <= MaxMeshSection; X++) { ChunkPtr->SectionList[X].isMeshDirty = true; }
+
+    // Same for chunk borders
+    fBool isBorder[F_VOXEL_NEIGHBOUR_NUM] = {
+        IN_MinZ == 0,
+        IN_MaxZ == (fInt)ChunkSize_Z - 1,
+        IN_MaxX == (fInt)ChunkSize_X - 1,
+        IN_MinX == 0
+    };
+    // Ambient occlusion also reaches one voxel up / down and the diagonal chunks
+    if (isAmbientOcclusion) {
+        MinSection = MinMeshSection;
+        MaxSection = MaxMeshSection;
+    }
+    for (fUInt N = 0; N < F_VOXEL_NEIGHBOUR_NUM; N++) {
+        fVoxelChunk* NeighbourPtr = ChunkPtr->NeighbourList[N];
+        if (!isBorder[N] || NeighbourPtr == nullptr) { continue; }
+
+        NeighbourPtr->isMeshDirty = true;
+        for (fInt X = MinSection; X <= MaxSection; X++) { NeighbourPtr->SectionList[X].isMeshDirty = true; }
+    }
+    for (fUInt C = 0; C < 4 && isAmbientOcclusion; C++) {
+        if (!isBorder[(C & 1) ? F_VOXEL_NEIGHBOUR_LEFT : F_VOXEL_NEIGHBOUR_RIGHT]) { continue; }
+        if (!isBorder[(C & 2) ? F_VOXEL_NEIGHBOUR_BACK : F_VOXEL_NEIGHBOUR_FRONT]) { continue; }
+
+        fVoxelChunk* DiagonalPtr = _Internal_GetDiagonal(ChunkPtr, C);
+        if (DiagonalPtr == nullptr) { continue; }
+
+        DiagonalPtr->isMeshDirty = true;
+        for (fInt X = MinSection; X <= MaxSection; X++) { DiagonalPtr->SectionList[X].isMeshDirty = true; }
+    }
+
+    // Heights of a chunk written directly can not be updated, only rebuilt
+    if (ChunkPtr->isHeightmapDirty) { _Internal_BuildHeightmap(ChunkPtr); }
+    else { _Internal_UpdateHeightmap(ChunkPtr, IN_MinX, IN_MinZ, IN_MaxX, IN_MaxY, IN_MaxZ); }
+    if (isLighting && ChunkPtr->isLightReady) { _Internal_RelightBox(ChunkPtr, IN_MinX, IN_MinY, IN_MinZ, IN_MaxX, IN_MaxY, IN_MaxZ); }
+}
+fUInt fVoxelWorld::_Internal_GetBrickVoxelIndex(fUInt IN_X, fUInt IN_Y, fUInt IN_Z) {
+    // Brick > Y > Z > X, then Morton within the brick
+    fUInt Brick = (IN_Y >> F_VOXEL_BRICK_SHIFT) * LayoutBricks_Z;
+    Brick = (Brick + (IN_Z >> F_VOXEL_BRICK_SHIFT)) * LayoutBricks_X;
+    Brick += IN_X >> F_VOXEL_BRICK_SHIFT;
+
+    fUInt Mask = F_VOXEL_BRICK_SIZE - 1;
+    return (Brick * F_VOXEL_BRICK_VOLUME) + fVoxel_MortonEncodeBrick(IN_X & Mask, IN_Y & Mask, IN_Z & Mask);
+}
+fVector3ui fVoxelWorld::_Internal_GetVoxelPosition(fUInt IN_Index) {
+    if (VoxelLayout == F_VOXEL_LAYOUT_BRICK) {
+        fUInt Brick = IN_Index / F_VOXEL_BRICK_VOLUME;
+        fVector3ui Result = fVoxel_MortonDecodeBrick(IN_Index % F_VOXEL_BRICK_VOLUME);
+
+        Result.X += (Brick % LayoutBricks_X) << F_VOXEL_BRICK_SHIFT;
+        Brick /= LayoutBricks_X;
+        Result.Z += (Brick % LayoutBricks_Z) << F_VOXEL_BRICK_SHIFT;
+        Result.Y += (Brick / LayoutBricks_Z) << F_VOXEL_BRICK_SHIFT;
+        return Result;
+    }
+
+    fVector3ui Result;
+    if (IndexShift_Y >= 0) {
+        Result.X = IN_Index & (ChunkSize_X - 1);
+        Result.Z = (IN_Index >> IndexShift_Z) & (ChunkSize_Z - 1);
+        Result.Y = IN_Index >> IndexShift_Y;
+        return Result;
+    }
+
+    Result.X = IN_Index % ChunkSize_X;
+    IN_Index /= ChunkSize_X;
+    Result.Z = IN_Index % ChunkSize_Z;
+    Result.Y = IN_Index / ChunkSize_Z;
+    return Result;
 }
 fUInt fVoxelWorld::_Internal_GetEmptyChunk() {
     for (fLong X = 0; X < ChunksPerWorld; X++) {
-        if (ChunkList[X].isExist == false) { return X; }
+        if (ChunkList[X]->isExist == false) { return X; }
     }
+
+    // No empty chunk left - new chunks are added at the end of ChunkList
+    fUInt Index = ChunksPerWorld;
+    if (_Internal_GrowChunkPool()) { return Index; }
+
     return F_UINT_MAX;
 }
-fBool fVoxelWorld::_Internal_GenerateVoxel(fUInt IN_ChunkIndex, fUInt IN_BlockIndex, fVoxelLocalPos IN_Pos, fProcMesh& OUT_Mesh) {
-    fProcMesh CurrMesh;
-    fVoxelGlobalPos GPos = GetVoxelGlobalPos(IN_Pos);
+fLong fVoxelWorld::_Internal_GetTimeMS() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+fUInt fVoxelWorld::_Internal_GetPoolMinChunks() {
+    if (ChunkPool_MinChunks > 0) { return ChunkPool_MinChunks; }
+    return WorldSize_X * WorldSize_Z;
+}
+fUInt fVoxelWorld::_Internal_GetPoolMaxChunks() {
+    fUInt MinChunks = _Internal_GetPoolMinChunks();
+    fUInt MaxChunks = ChunkPool_MaxChunks;
+    if (MaxChunks == 0) { MaxChunks = WorldSize_X * WorldSize_Z; }
 
-    // 0 - Front	Z-
-    if (TempVertNum_Front > 0) {
-        if (IN_Pos.LocalZ > 0) {
-            fUInt I = ChunkList[IN_ChunkIndex].GetVoxelIndex(IN_Pos.LocalX, IN_Pos.LocalY, IN_Pos.LocalZ - 1);
-            if (ChunkList[IN_ChunkIndex].BlockList[I] == F_UINT_MAX) { CurrMesh += VoxelMesh[0]; }
-        }
-        else {
-            fVoxelGlobalPos TempPos = GPos;
-            TempPos.GlobalZ--;
-            fUInt Index = GetVoxelIndex(TempPos.GlobalX,TempPos.GlobalY,TempPos.GlobalZ);
-            if (Index == F_UINT_MAX) { CurrMesh += VoxelMesh[0]; }
-        }
+    if (MaxChunks < MinChunks) { return MinChunks; }
+    return MaxChunks;
+}
+fBool fVoxelWorld::_Internal_GrowChunkPool() {
+    fUInt MaxChunks = _Internal_GetPoolMaxChunks();
+    if (ChunksPerWorld >= MaxChunks) { return false; }
+
+    fUInt Num = ChunkPool_SlabSize;
+    if (ChunksPerWorld + Num > MaxChunks) { Num = MaxChunks - ChunksPerWorld; }
+
+    // Moving the slab vector around keeps its allocation, so chunk pointers remain valid
+    ChunkSlabList.push_back(std::vector<fVoxelChunk>(Num, fVoxelChunk(this)));
+    std::vector<fVoxelChunk>& Slab = ChunkSlabList.back();
+    for (fUInt X = 0; X < Num; X++) {
+        Slab[X].SectionList.resize(SectionsPerChunk);
+        ChunkList.push_back(&Slab[X]);
     }
+    ChunksPerWorld = ChunkList.size();
 
-    // 1 - Back		Z+
-    if (TempVertNum_Back > 0) {
-        if (IN_Pos.LocalZ < (fInt)ChunkSize_Z - 1) {
-            fUInt I = ChunkList[IN_ChunkIndex].GetVoxelIndex(IN_Pos.LocalX, IN_Pos.LocalY, IN_Pos.LocalZ + 1);
-            if (ChunkList[IN_ChunkIndex].BlockList[I] == F_UINT_MAX) { CurrMesh += VoxelMesh[1]; }
+    Log(F_LOG_SEV_DEBUG,"FVoxelWorld","Chunk pool grown to [" + std::to_string(ChunksPerWorld) + "] chunks");
+    return true;
+}
+fUInt* fVoxelWorld::_Internal_AcquireBlockList() {
+    fLong AllocSize = sizeof(fUInt) * BlocksPerChunk;
+    fUInt* Result = nullptr;
+
+    if (BlockListCache.size() > 0) {
+        // Most recently released first - most likely to be still in cache / resident
+        Result = BlockListCache.back().BlockList;
+        BlockListCache.pop_back();
+    }
+    else {
+        if (ChunkPool_MemoryBudget > 0 && ChunkPool_AllocatedBytes + AllocSize > ChunkPool_MemoryBudget) {
+            Log(
+                F_LOG_SEV_ERROR,
+                "FVoxelWorld",
+                "Unable to allocate BlockList. Memory budget of [" + std::to_string(ChunkPool_MemoryBudget) + "] bytes reached."
+            );
+            return nullptr;
         }
-        else {
-            fVoxelGlobalPos TempPos = GPos;
-            TempPos.GlobalZ++;
-            fUInt Index = GetVoxelIndex(TempPos.GlobalX,TempPos.GlobalY,TempPos.GlobalZ);
-            if (Index == F_UINT_MAX) { CurrMesh += VoxelMesh[1]; }
+
+        Result = _Internal_AllocBlockList();
+        if (Result == nullptr) {
+            Log(F_LOG_SEV_ERROR,"FVoxelWorld","Unable to allocate BlockList. Allocator returned NULLPTR.");
+            return nullptr;
         }
+        ChunkPool_AllocatedBytes += AllocSize;
     }
 
-    // 2 - Left		X+
-    if (TempVertNum_Left > 0) {
-        if (IN_Pos.LocalX < (fInt)ChunkSize_X - 1) {
-            fUInt I = ChunkList[IN_ChunkIndex].GetVoxelIndex(IN_Pos.LocalX + 1, IN_Pos.LocalY, IN_Pos.LocalZ);
-            if (ChunkList[IN_ChunkIndex].BlockList[I] == F_UINT_MAX) { CurrMesh += VoxelMesh[2]; }
-        }
-        else {
-            fVoxelGlobalPos TempPos = GPos;
-            TempPos.GlobalX++;
-            fUInt Index = GetVoxelIndex(TempPos.GlobalX,TempPos.GlobalY,TempPos.GlobalZ);
-            if (Index == F_UINT_MAX) { CurrMesh += VoxelMesh[2]; }
-        }
+    memset(Result, 0xFF, AllocSize);
+    return Result;
+}
+fUInt* fVoxelWorld::_Internal_AllocBlockList() {
+    if (BlockArena.isReserved()) {
+        fUInt* Result = (fUInt*)BlockArena.Alloc();
+        if (Result != nullptr) { return Result; }
+        BlockArena.GetStats().FallbackAllocs++;
     }
+    return (fUInt*)Allocator(sizeof(fUInt) * BlocksPerChunk);
+}
+void fVoxelWorld::_Internal_FreeBlockList(fUInt* IN_BlockList) {
+    if (BlockArena.Free(IN_BlockList)) { return; }
+    DeAllocator(IN_BlockList);
+}
+void fVoxelWorld::_Internal_ReleaseBlockList(fUInt* IN_BlockList) {
+    if (IN_BlockList == nullptr) { return; }
 
-    // 3 - Right	X-
-    if (TempVertNum_Right > 0) {
-        if (IN_Pos.LocalX > 0) {
-            fUInt I = ChunkList[IN_ChunkIndex].GetVoxelIndex(IN_Pos.LocalX - 1, IN_Pos.LocalY, IN_Pos.LocalZ);
-            if (ChunkList[IN_ChunkIndex].BlockList[I] == F_UINT_MAX) { CurrMesh += VoxelMesh[3]; }
-        }
-        else {
-            fVoxelGlobalPos TempPos = GPos;
-            TempPos.GlobalX--;
-            fUInt Index = GetVoxelIndex(TempPos.GlobalX,TempPos.GlobalY,TempPos.GlobalZ);
-            if (Index == F_UINT_MAX) { CurrMesh += VoxelMesh[3]; }
-        }
+    fVoxelCachedBlockList Entry;
+    Entry.BlockList = IN_BlockList;
+    Entry.ReleaseTime = _Internal_GetTimeMS();
+    BlockListCache.push_back(Entry);
+}
+fLong fVoxelWorld::_Internal_FreeCachedBlockLists(fLong IN_Time) {
+    fLong AllocSize = sizeof(fUInt) * BlocksPerChunk;
+    fLong Freed = 0;
+
+    // Entries are pushed in release order, so the oldest ones are at the front
+    fUInt Num = BlockListCache.size();
+    fUInt Count = 0;
+    while (Count < Num && BlockListCache[Count].ReleaseTime <= IN_Time) {
+        _Internal_FreeBlockList(BlockListCache[Count].BlockList);
+        Freed += AllocSize;
+        Count++;
     }
 
-    // 4 - Top		Y+
-    if (TempVertNum_Top > 0) {
-        if (IN_Pos.LocalY < (fInt)ChunkSize_Y - 1) {
-            fUInt I = ChunkList[IN_ChunkIndex].GetVoxelIndex(IN_Pos.LocalX, IN_Pos.LocalY + 1, IN_Pos.LocalZ);
-            if (ChunkList[IN_ChunkIndex].BlockList[I] == F_UINT_MAX) { CurrMesh += VoxelMesh[4]; }
-        }
-        else { CurrMesh += VoxelMesh[4]; }
+    if (Count > 0) {
+        BlockListCache.erase(BlockListCache.begin(), BlockListCache.begin() + Count);
+        ChunkPool_AllocatedBytes -= Freed;
     }
 
-    // 5 - Bottom	Y-
-    if (TempVertNum_Bottom > 0) {
-        if (IN_Pos.LocalY > 0) {
-            fUInt I = ChunkList[IN_ChunkIndex].GetVoxelIndex(IN_Pos.LocalX, IN_Pos.LocalY - 1, IN_Pos.LocalZ);
-            if (ChunkList[IN_ChunkIndex].BlockList[I] == F_UINT_MAX) { CurrMesh += VoxelMesh[5]; }
+    return Freed;
+}
+fBool fVoxelWorld::_Internal_GenerateVoxel(const fUInt* IN_Padded, fUInt IN_PadIndex, fVoxelLocalPos IN_Pos, const fProcMesh* IN_FaceMesh, fProcMesh& OUT_Mesh) {
+    fProcMesh CurrMesh;
+    fUInt StrideZ = MeshPad_X;
+    fUInt StrideY = MeshPad_X * MeshPad_Z;
+    fUInt BlockID = IN_Padded[IN_PadIndex];
+
+    // The padded volume holds the voxels around the chunk too, so no bounds checks are needed
+    // see "fVoxelBlockRegistry::GetisFaceHidden()" for the culling rules
+    const fVoxelBlockRegistry& Reg = BlockRegistry;
+    fBool isFace[7] = {
+        TempVertNum_Front > 0 && !Reg.GetisFaceHidden(BlockID, IN_Padded[IN_PadIndex - StrideZ]),     // 0 - Front	Z-
+        TempVertNum_Back > 0 && !Reg.GetisFaceHidden(BlockID, IN_Padded[IN_PadIndex + StrideZ]),      // 1 - Back		Z+
+        TempVertNum_Left > 0 && !Reg.GetisFaceHidden(BlockID, IN_Padded[IN_PadIndex + 1]),            // 2 - Left		X+
+        TempVertNum_Right > 0 && !Reg.GetisFaceHidden(BlockID, IN_Padded[IN_PadIndex - 1]),           // 3 - Right	X-
+        TempVertNum_Top > 0 && !Reg.GetisFaceHidden(BlockID, IN_Padded[IN_PadIndex + StrideY]),       // 4 - Top		Y+
+        TempVertNum_Bottom > 0 && !Reg.GetisFaceHidden(BlockID, IN_Padded[IN_PadIndex - StrideY]),    // 5 - Bottom	Y-
+        TempVertNum_Always > 0                                                                        // 6 - Always
+    };
+
+    // Padded volume offset along X, Y, Z
+    const fInt Stride[3] = { 1, (fInt)StrideY, (fInt)StrideZ };
+
+    // Texture of each face
+    const fVoxelUVRect* RectList = BlockRegistry.GetUVRects(BlockID);
+    const fUInt* TileList = BlockRegistry.GetTiles(BlockID);
+
+    for (fUInt F = 0; F < 7; F++) {
+        if (!isFace[F]) { continue; }
+
+        fUInt Start = CurrMesh.GetVertexNum();
+        fUInt UVStart = CurrMesh.UVs.size();
+        fUInt IndexStart = CurrMesh.Indices.size();
+        CurrMesh += IN_FaceMesh[F];
+
+        // Light of the voxel the face is looking at ("Always" face uses the voxel itself)
+        if (isLighting) {
+            fUInt LightIndex = IN_PadIndex;
+            if (F < 6) { LightIndex += fVoxel_FaceAxis[F][1] * Stride[fVoxel_FaceAxis[F][0]]; }
+            fUInt Light = LightScratch[LightIndex];
+
+            fUInt End = CurrMesh.GetVertexNum();
+            if (CurrMesh.GetisPacked()) {
+                for (fUInt X = Start; X < End; X++) { CurrMesh.Packed[X].B |= Light << 23; }
+            } else {
+                fVoxelColor Color;
+                Color.R = (Light >> 4) * 17;
+                Color.G = (Light & 0xF) * 17;
+                CurrMesh.Colors.resize(End, Color);
+            }
+        }
+
+        if (isAmbientOcclusion && F < 6) { _Internal_ApplyFaceAO(IN_Padded, IN_PadIndex, F, CurrMesh, Start, IndexStart); }
+        if (RectList == nullptr) { continue; }
+
+        // Packed vertices only store the tile
+        for (fUInt X = Start; X < CurrMesh.Packed.size(); X++) { CurrMesh.Packed[X].B |= TileList[F]; }
+
+        const fVoxelUVRect& Rect = RectList[F];
+        for (fUInt X = UVStart; X < CurrMesh.UVs.size(); X++) {
+            CurrMesh.UVs[X].X = Rect.U + (CurrMesh.UVs[X].X * Rect.StepU);
+            CurrMesh.UVs[X].Y = Rect.V + (CurrMesh.UVs[X].Y * Rect.StepV);
         }
-        else { CurrMesh += VoxelMesh[5]; }
     }
 
-    // 6 - Always
-    if (TempVertNum_Always > 0) { CurrMesh += VoxelMesh[6]; }
+    // "Always" face is never occluded
+    if (isAmbientOcclusion && !CurrMesh.GetisPacked()) { CurrMesh.AO.resize(CurrMesh.Vertecies.size(), 3); }
+
+    // Packed vertices only need the voxel position
+    if (CurrMesh.GetisPacked()) {
+        fUInt PosBits = fVoxelPackedVertex::PackPosition(IN_Pos.LocalX, IN_Pos.LocalY, IN_Pos.LocalZ);
+        for (fUInt X = 0; X < CurrMesh.Packed.size(); X++) { CurrMesh.Packed[X].A += PosBits; }
+
+        OUT_Mesh += CurrMesh;
+        return CurrMesh.Packed.size() > 0;
+    }
 
     // Move Curr Mesh to Corrent Position
     fUInt Num = CurrMesh.Vertecies.size();
-    fBool isUVs = CurrMesh.UVs.size() > 0;
     if (Num > 0) {
         fFloat OffsetX = IN_Pos.LocalX * VoxelSize_X;
         fFloat OffsetY = IN_Pos.LocalY * VoxelSize_Y;
@@ -757,13 +1510,6 @@ fBool fVoxelWorld::_Internal_GenerateVoxel(fUInt IN_ChunkIndex, fUInt IN_BlockIn
             CurrMesh.Vertecies[X].X += OffsetX;
             CurrMesh.Vertecies[X].Y += OffsetY;
             CurrMesh.Vertecies[X].Z += OffsetZ;
-            if (isUVs) {
-                fVoxelBlock& BlockRef = VoxelList[ChunkList[IN_ChunkIndex].BlockList[IN_BlockIndex]];
-                CurrMesh.UVs[X].X *= TextureStep_X;
-                CurrMesh.UVs[X].Y *= TextureStep_Y;
-                CurrMesh.UVs[X].X += BlockRef.Texture.X * TextureStep_X;
-                CurrMesh.UVs[X].Y += BlockRef.Texture.Y * TextureStep_Y;
-            }
         }
     }
 
@@ -771,6 +1517,109 @@ fBool fVoxelWorld::_Internal_GenerateVoxel(fUInt IN_ChunkIndex, fUInt IN_BlockIn
     OUT_Mesh += CurrMesh;
     return CurrMesh.Vertecies.size() > 0;
 }
+fUInt fVoxelWorld::_Internal_GetFaceAO(const fUInt* IN_Padded, fUInt IN_PadIndex, fUInt IN_Face) {
+    const fInt Stride[3] = { 1, (fInt)(MeshPad_X * MeshPad_Z), (fInt)MeshPad_X };
+    const fInt* Axis = fVoxel_FaceAxis[IN_Face];
+
+    // Voxel the face is looking at - Its neighbours along U and V are the occluders
+    const fUInt* Front = IN_Padded + IN_PadIndex + (Axis[1] * Stride[Axis[0]]);
+
+    fUInt Result = 0;
+    for (fUInt C = 0; C < 4; C++) {
+        fInt DU = (C & 1) ? Stride[Axis[2]] : -Stride[Axis[2]];
+        fInt DV = (C & 2) ? Stride[Axis[3]] : -Stride[Axis[3]];
+
+        fUInt Side1 = BlockRegistry.GetisOpaque(Front[DU]);
+        fUInt Side2 = BlockRegistry.GetisOpaque(Front[DV]);
+        fUInt Corner = BlockRegistry.GetisOpaque(Front[DU + DV]);
+
+        // 2 sides fully occlude the corner, regardless of the voxel between them
+        fUInt AO = (Side1 && Side2) ? 0 : 3 - (Side1 + Side2 + Corner);
+        Result |= AO << (C * 2);
+    }
+
+    return Result;
+}
+void fVoxelWorld::_Internal_ApplyFaceAO(const fUInt* IN_Padded, fUInt IN_PadIndex, fUInt IN_Face, fProcMesh& REF_Mesh, fUInt IN_Start, fUInt IN_IndexStart) {
+    fUInt FaceAO = _Internal_GetFaceAO(IN_Padded, IN_PadIndex, IN_Face);
+    const fInt* Axis = fVoxel_FaceAxis[IN_Face];
+    const fFloat Half[3] = { VoxelSize_X * 0.5F, VoxelSize_Y * 0.5F, VoxelSize_Z * 0.5F };
+    fUInt End = REF_Mesh.GetVertexNum();
+
+    fBool isPacked = REF_Mesh.GetisPacked();
+    if (!isPacked) { REF_Mesh.AO.resize(End, 3); }
+
+    for (fUInt X = IN_Start; X < End; X++) {
+        fUInt AO = (FaceAO >> (fVoxel_GetFaceCorner(REF_Mesh, X, Axis, Half) * 2)) & 0x3;
+        if (isPacked) { REF_Mesh.Packed[X].B |= AO << 21; }
+        else { REF_Mesh.AO[X] = AO; }
+    }
+
+    // Only quads (2 triangles) can be flipped
+    fBool isIndexed = REF_Mesh.GetisIndexed();
+    if (isIndexed ? (REF_Mesh.Indices.size() - IN_IndexStart != 6) : (End - IN_Start != 6)) { return; }
+
+    fUInt Slot[6];
+    fUInt Corner[6];
+    fUInt AO[6];
+    for (fUInt X = 0; X < 6; X++) {
+        Slot[X] = isIndexed ? REF_Mesh.Indices[IN_IndexStart + X] : IN_Start + X;
+        Corner[X] = fVoxel_GetFaceCorner(REF_Mesh, Slot[X], Axis, Half);
+        AO[X] = (FaceAO >> (Corner[X] * 2)) & 0x3;
+    }
+    if (Corner[0] == Corner[1] || Corner[1] == Corner[2] || Corner[0] == Corner[2]) { return; }
+
+    // A / B - Corner only used by the first / second triangle, the other 2 are the shared diagonal
+    fUInt A = F_UINT_MAX;
+    fUInt B = F_UINT_MAX;
+    for (fUInt X = 0; X < 3; X++) {
+        if (Corner[X] != Corner[3] && Corner[X] != Corner[4] && Corner[X] != Corner[5]) { A = X; }
+        if (Corner[X + 3] != Corner[0] && Corner[X + 3] != Corner[1] && Corner[X + 3] != Corner[2]) { B = X + 3; }
+    }
+    if (A == F_UINT_MAX || B == F_UINT_MAX) { return; }
+
+    // Keep the diagonal with the lowest occlusion sum - Otherwise the gradient is anisotropic
+    fUInt D1 = (A + 1) % 3;
+    fUInt D2 = (A + 2) % 3;
+    if (AO[D1] + AO[D2] <= AO[A] + AO[B]) { return; }
+
+    // Same winding: A > D1 > B > D2 around the quad
+    const fUInt Order[6] = { A, D1, B, B, D2, A };
+    if (isIndexed) {
+        for (fUInt X = 0; X < 6; X++) { REF_Mesh.Indices[IN_IndexStart + X] = Slot[Order[X]]; }
+        return;
+    }
+
+    fVoxel_ReorderQuad(REF_Mesh.Vertecies, IN_Start, Order);
+    fVoxel_ReorderQuad(REF_Mesh.Normals, IN_Start, Order);
+    fVoxel_ReorderQuad(REF_Mesh.UVs, IN_Start, Order);
+    fVoxel_ReorderQuad(REF_Mesh.AO, IN_Start, Order);
+    fVoxel_ReorderQuad(REF_Mesh.Colors, IN_Start, Order);
+    fVoxel_ReorderQuad(REF_Mesh.Packed, IN_Start, Order);
+}
+void fVoxelWorld::_Internal_UpdateRegistry() {
+    BlockRegistry.Build(VoxelList, TextureStep_X, TextureStep_Y);
+
+    // Solid blocks may have changed
+    for (fUInt X = 0; X < ChunksPerWorld; X++) {
+        if (!ChunkList[X]->isExist) { continue; }
+        _Internal_BuildHeightmap(ChunkList[X]);
+        _Internal_BuildOccupancy(ChunkList[X]);
+    }
+
+    // Opacity / emitted light may have changed
+    if (isLighting) { _Internal_ResetLight(); }
+    _Internal_MarkAllMeshDirty();
+}
+void fVoxelWorld::SetTextureSteps(fFloat IN_StepX, fFloat IN_StepY) {
+    TextureStep_X = IN_StepX;
+    TextureStep_Y = IN_StepY;
+    _Internal_UpdateRegistry();
+}
+void fVoxelWorld::SetVoxelList(std::vector<fVoxelBlock> IN_BlockList) {
+    VoxelList = IN_BlockList;
+    _Internal_UpdateRegistry();
+}
 
 
 fBool fVoxelWorld::CreateWorld(std::string IN_FolderPath, fBool IN_isForceCreate) {
@@ -821,8 +1670,20 @@ fBool fVoxelWorld::LoadWorld(std::string IN_FilePath) {
         Log(F_LOG_SEV_ERROR,"FVoxelWorld","Unable to Load world. World file at [" + IN_FilePath + "] does not exist.");
         return false;
     }
+
+    fUInt LockedSize[4] = { ChunkSize_X, ChunkSize_Y, ChunkSize_Z, VoxelLayout };
     _Internal_LoadWorldProp(IN_FilePath);
 
+    if (isLayoutLocked && (ChunkSize_X != LockedSize[0] || ChunkSize_Y != LockedSize[1] || ChunkSize_Z != LockedSize[2] || VoxelLayout != LockedSize[3])) {
+        Log(F_LOG_SEV_ERROR,"FVoxelWorld","Unable to Load world. World at [" + IN_FilePath + "] does not match the locked chunk size / layout.");
+        ChunkSize_X = LockedSize[0];
+        ChunkSize_Y = LockedSize[1];
+        ChunkSize_Z = LockedSize[2];
+        VoxelLayout = LockedSize[3];
+        _Internal_UpdateDividers();
+        return false;
+    }
+
     std::filesystem::path Temp(IN_FilePath);
     Temp = Temp.parent_path();
     SavePath = Temp.parent_path();
@@ -871,28 +1732,39 @@ fUInt fVoxelWorld::SpawnChunk(fInt IN_PosX, fInt IN_PosZ) {
     }
 
     // Configure Chunk
-    ChunkList[ChunkIndex].isExist = true;
-    ChunkList[ChunkIndex].PosX = IN_PosX;
-    ChunkList[ChunkIndex].PosZ = IN_PosZ;
-    ChunkList[ChunkIndex].RegionPtr = &RegionList[RIndex];
-    ChunkList[ChunkIndex].RegionEntryIndex = RegionList[RIndex].GetChunkEntryIndex(IN_PosX, IN_PosZ);
-
-    if (!ChunkList[ChunkIndex].isAllocated) {
-        fLong AllocSize = sizeof(fUInt) * BlocksPerChunk;
-        ChunkList[ChunkIndex].BlockList = (fUInt*)Allocator(AllocSize);
-        memset(ChunkList[ChunkIndex].BlockList, 0xFF , AllocSize);
-        ChunkList[ChunkIndex].isAllocated = true;
-    }
-
-    if (ChunkList[ChunkIndex].RegionEntryIndex < F_UINT_MAX) {
+    // BlockList is allocated on first write / load, until then every voxel is Air
+    ChunkList[ChunkIndex]->UniformBlock = F_UINT_MAX;
+    ChunkList[ChunkIndex]->isExist = true;
+    ChunkList[ChunkIndex]->isModified = false;
+    ChunkList[ChunkIndex]->isVoxelGenerated = false;
+    ChunkList[ChunkIndex]->isMeshGenerated = false;
+    ChunkList[ChunkIndex]->isMeshDirty = true;
+    ChunkList[ChunkIndex]->isLightReady = false;
+    ChunkList[ChunkIndex]->VisibleVoxels = 0;
+    for (fUInt X = 0; X < SectionsPerChunk; X++) { ChunkList[ChunkIndex]->SectionList[X] = fVoxelSection(); }
+    for (fUInt X = 0; X < F_CHUNK_TICKET_LEVEL_NUM; X++) { ChunkList[ChunkIndex]->TicketCount[X] = 0; }
+    ChunkList[ChunkIndex]->SpawnID = ++LastSpawnID;
+    ChunkList[ChunkIndex]->PosX = IN_PosX;
+    ChunkList[ChunkIndex]->PosZ = IN_PosZ;
+    ChunkList[ChunkIndex]->RegionPtr = &RegionList[RIndex];
+    ChunkList[ChunkIndex]->RegionEntryIndex = RegionList[RIndex].GetChunkEntryIndex(IN_PosX, IN_PosZ);
+    ChunkMap[_Internal_GetChunkKey(IN_PosX, IN_PosZ)] = ChunkIndex;
+
+    // Faces along the border of the neighbours are now culled by this chunk
+    _Internal_LinkNeighbours(ChunkList[ChunkIndex]);
+    _Internal_MarkNeighboursDirty(ChunkList[ChunkIndex]);
+
+    if (ChunkList[ChunkIndex]->RegionEntryIndex < F_UINT_MAX) {
         Log(F_LOG_SEV_ERROR,"FVoxelWorld","Loading Chunk [" + std::to_string(IN_PosX) + "," + std::to_string(IN_PosZ) + "]");
-        ChunkList[ChunkIndex].LoadChunkData();
+        ChunkList[ChunkIndex]->LoadChunkData();
     }
     else {
         Log(F_LOG_SEV_ERROR,"FVoxelWorld","Creating Chunk [" + std::to_string(IN_PosX) + "," + std::to_string(IN_PosZ) + "]");
     }
+    _Internal_BuildHeightmap(ChunkList[ChunkIndex]);
+    _Internal_BuildOccupancy(ChunkList[ChunkIndex]);
 
-    return RIndex;
+    return ChunkIndex;
 }
 fBool fVoxelWorld::SaveChunk(fUInt IN_ChunkIndex) {
     if (!isInit) {
@@ -903,20 +1775,20 @@ fBool fVoxelWorld::SaveChunk(fUInt IN_ChunkIndex) {
         Log(F_LOG_SEV_ERROR,"FVoxelWorld","Unable to save chunk. Invalid Chunk Index");
         return false;
     }
-    Log(F_LOG_SEV_DEBUG,"FVoxelWorld","Saving Chunk [" + std::to_string(ChunkList[IN_ChunkIndex].PosX) + "," + std::to_string(ChunkList[IN_ChunkIndex].PosZ) + "]");
+    Log(F_LOG_SEV_DEBUG,"FVoxelWorld","Saving Chunk [" + std::to_string(ChunkList[IN_ChunkIndex]->PosX) + "," + std::to_string(ChunkList[IN_ChunkIndex]->PosZ) + "]");
 
-    if (!ChunkList[IN_ChunkIndex].isExist) {
+    if (!ChunkList[IN_ChunkIndex]->isExist) {
         Log(F_LOG_SEV_ERROR,"FVoxelWorld","Unable to save chunk. Chunk not yet loaded");
         return false;
     }
-    if (ChunkList[IN_ChunkIndex].isModified) {
+    if (ChunkList[IN_ChunkIndex]->isModified) {
         Log(F_LOG_SEV_DEBUG,"FVoxelWorld","Save Chunk data for Chunk[" + std::to_string(IN_ChunkIndex) + "]");
-        return ChunkList[IN_ChunkIndex].SaveChunkData();
+        return ChunkList[IN_ChunkIndex]->SaveChunkData();
     }
 
     return true;
 }
-fBool fVoxelWorld::UnloadChunk(fUInt IN_ChunkIndex, fBool IN_isSave) {
+fBool fVoxelWorld::UnloadChunk(fUInt IN_ChunkIndex, fBool IN_isSave, fBool IN_isForce) {
     if (!isInit) {
         Log(F_LOG_SEV_ERROR,"FVoxelWorld","Unable unload chunk. World not yet initialised");
         return false;
@@ -931,14 +1803,38 @@ fBool fVoxelWorld::UnloadChunk(fUInt IN_ChunkIndex, fBool IN_isSave) {
         return false;
     }
 
+    if (ChunkList[IN_ChunkIndex]->isExist && ChunkList[IN_ChunkIndex]->GetTicketLevel() != F_UINT_MAX && !IN_isForce) {
+        Log(F_LOG_SEV_ERROR,"FVoxelWorld","Unable to unload Chunk[" + std::to_string(IN_ChunkIndex) + "]. Chunk is held by a ticket");
+        return false;
+    }
+
     Log(F_LOG_SEV_DEBUG,"FVoxelWorld","Unload Chunk[" + std::to_string(IN_ChunkIndex) + "]");
 
     if (IN_isSave) {
-        if (ChunkList[IN_ChunkIndex].isModified) {
-            ChunkList[IN_ChunkIndex].SaveChunkData();
+        if (ChunkList[IN_ChunkIndex]->isModified) {
+            ChunkList[IN_ChunkIndex]->SaveChunkData();
         }
     }
-    ChunkList[IN_ChunkIndex].isExist = false;
+
+    // Give the BlockList back to the pool - deallocated by "UpdateChunkPool()" once idle
+    if (ChunkList[IN_ChunkIndex]->isAllocated) {
+        _Internal_ReleaseBlockList(ChunkList[IN_ChunkIndex]->BlockList);
+        ChunkList[IN_ChunkIndex]->BlockList = nullptr;
+        ChunkList[IN_ChunkIndex]->isAllocated = false;
+    }
+
+    if (ChunkList[IN_ChunkIndex]->isExist) {
+        ChunkMap.erase(_Internal_GetChunkKey(ChunkList[IN_ChunkIndex]->PosX, ChunkList[IN_ChunkIndex]->PosZ));
+        _Internal_MarkNeighboursDirty(ChunkList[IN_ChunkIndex]);
+        _Internal_UnlinkNeighbours(ChunkList[IN_ChunkIndex]);
+    }
+
+    // Drop the cached section meshes and light
+    for (fUInt X = 0; X < SectionsPerChunk; X++) { ChunkList[IN_ChunkIndex]->SectionList[X] = fVoxelSection(); }
+    for (fUInt X = 0; X <= F_VOXEL_PASS_NUM; X++) { _Internal_ResetSpliceState(ChunkList[IN_ChunkIndex]->SpliceList[X]); }
+    ChunkList[IN_ChunkIndex]->isLightReady = false;
+
+    ChunkList[IN_ChunkIndex]->isExist = false;
     return true;
 }
 fVoxelChunk* fVoxelWorld::GetChunkPtr(fUInt IN_ChunkIndex) {
@@ -956,12 +1852,12 @@ fVoxelChunk* fVoxelWorld::GetChunkPtr(fUInt IN_ChunkIndex) {
         return nullptr;
     }
 
-    return &ChunkList[IN_ChunkIndex];
+    return ChunkList[IN_ChunkIndex];
 }
 fBool fVoxelWorld::SaveWorld() {
     for (fUInt X = 0; X < ChunksPerWorld; X++) {
-        if (ChunkList[X].isExist && ChunkList[X].isModified) {
-            if (!ChunkList[X].SaveChunkData()) {
+        if (ChunkList[X]->isExist && ChunkList[X]->isModified) {
+            if (!ChunkList[X]->SaveChunkData()) {
                 return false;
             }
         }
@@ -980,16 +1876,26 @@ fBool fVoxelWorld::UnloadWorld() {
     // Deallocate All blocklists
     Log(F_LOG_SEV_DEBUG,"FVoxelWorld","Deallocate Block Lists");
     for (fUInt X = 0; X < ChunksPerWorld; X++) {
-        if (ChunkList[X].isAllocated) {
-            DeAllocator(ChunkList[X].BlockList);
-            ChunkList[X].isAllocated = false;
+        if (ChunkList[X]->isAllocated) {
+            _Internal_FreeBlockList(ChunkList[X]->BlockList);
+            ChunkList[X]->BlockList = nullptr;
+            ChunkList[X]->isAllocated = false;
         }
     }
+    _Internal_FreeCachedBlockLists(F_LONG_MAX);
+    ChunkPool_AllocatedBytes = 0;
+    BlockArena.Release(DeAllocator);
 
     // Empty Chunks
     Log(F_LOG_SEV_DEBUG,"FVoxelWorld","Clear Chunks and Regions");
     ChunkList.clear();
+    ChunkSlabList.clear();
+    ChunkMap.clear();
+    LastChunkIndex = F_UINT_MAX;
     RegionList.clear();
+    TicketList.clear();
+    PendingUnloadList.clear();
+    SpliceOwnerMap.clear();
 
     // Reset Consts
     ChunksPerWorld = 0;
@@ -1000,7 +1906,151 @@ fBool fVoxelWorld::UnloadWorld() {
     Log(F_LOG_SEV_DEBUG,"FVoxelWorld","World Unloaded");
     return true;
 }
-fBool fVoxelWorld::SetVoxelMesh(std::vector<fProcMesh> IN_MeshList) {
+fUInt fVoxelWorld::AcquireChunk(fInt IN_PosX, fInt IN_PosZ, fUInt IN_Level, fUInt IN_Radius) {
+    if (!isInit) {
+        Log(F_LOG_SEV_ERROR,"FVoxelWorld","Unable to acquire chunk. World not yet initialised");
+        return F_UINT_MAX;
+    }
+    if (IN_Level >= F_CHUNK_TICKET_LEVEL_NUM) {
+        Log(F_LOG_SEV_ERROR,"FVoxelWorld","Unable to acquire chunk. Invalid ticket level [" + std::to_string(IN_Level) + "]");
+        return F_UINT_MAX;
+    }
+
+    // Reuse an inactive ticket if there is any
+    fUInt TicketID = F_UINT_MAX;
+    fUInt Num = TicketList.size();
+    for (fUInt X = 0; X < Num; X++) {
+        if (!TicketList[X].isActive) { TicketID = X; break; }
+    }
+    if (TicketID == F_UINT_MAX) {
+        TicketID = Num;
+        TicketList.push_back(fVoxelChunkTicket());
+    }
+
+    fVoxelChunkTicket& Ticket = TicketList[TicketID];
+    Ticket.PosX = IN_PosX;
+    Ticket.PosZ = IN_PosZ;
+    Ticket.Level = IN_Level;
+    Ticket.Radius = IN_Radius;
+    Ticket.ChunkPosList.clear();
+    Ticket.ChunkSpawnList.clear();
+    Ticket.isActive = true;
+
+    fInt R = IN_Radius;
+    for (fInt Z = IN_PosZ - R; Z <= IN_PosZ + R; Z++) {
+        for (fInt X = IN_PosX - R; X <= IN_PosX + R; X++) {
+            fUInt ChunkIndex = _Internal_GetChunkIndex(X, Z);
+            if (ChunkIndex == F_UINT_MAX) {
+                ChunkIndex = SpawnChunk(X, Z);
+                if (ChunkIndex == F_UINT_MAX) {
+                    Log(F_LOG_SEV_WARNING,"FVoxelWorld","Ticket [" + std::to_string(TicketID) + "] unable to hold Chunk [" + std::to_string(X) + "," + std::to_string(Z) + "]");
+                    continue;
+                }
+            }
+
+            ChunkList[ChunkIndex]->TicketCount[IN_Level]++;
+            Ticket.ChunkPosList.push_back({X,Z});
+            Ticket.ChunkSpawnList.push_back(ChunkList[ChunkIndex]->SpawnID);
+        }
+    }
+
+    return TicketID;
+}
+fBool fVoxelWorld::ReleaseChunk(fUInt IN_TicketID) {
+    if (!isInit) {
+        Log(F_LOG_SEV_ERROR,"FVoxelWorld","Unable to release chunk. World not yet initialised");
+        return false;
+    }
+    if (IN_TicketID >= TicketList.size() || !TicketList[IN_TicketID].isActive) {
+        Log(F_LOG_SEV_ERROR,"FVoxelWorld","Unable to release chunk. Invalid Ticket ID [" + std::to_string(IN_TicketID) + "]");
+        return false;
+    }
+
+    fVoxelChunkTicket& Ticket = TicketList[IN_TicketID];
+    fUInt Num = Ticket.ChunkPosList.size();
+    for (fUInt X = 0; X < Num; X++) {
+        fVector2i Pos = Ticket.ChunkPosList[X];
+
+        // Chunk may have been force unloaded in the mean time - and maybe respawned for an other ticket
+        fUInt ChunkIndex = _Internal_GetChunkIndex(Pos.X, Pos.Y);
+        if (ChunkIndex == F_UINT_MAX) { continue; }
+
+        fVoxelChunk* ChunkPtr = ChunkList[ChunkIndex];
+        if (ChunkPtr->SpawnID != Ticket.ChunkSpawnList[X]) { continue; }
+        if (ChunkPtr->TicketCount[Ticket.Level] == 0) { continue; }
+
+        ChunkPtr->TicketCount[Ticket.Level]--;
+        if (ChunkPtr->GetTicketLevel() == F_UINT_MAX) { PendingUnloadList.push_back(Pos); }
+    }
+
+    Ticket.ChunkPosList.clear();
+    Ticket.ChunkSpawnList.clear();
+    Ticket.isActive = false;
+    return true;
+}
+fUInt fVoxelWorld::UpdateChunkTickets(fUInt IN_MaxUnloads) {
+    if (!isInit) {
+        Log(F_LOG_SEV_ERROR,"FVoxelWorld","Unable to update chunk tickets. World not yet initialised");
+        return 0;
+    }
+
+    fUInt Count = 0;
+    fUInt Processed = 0;
+    fUInt Num = PendingUnloadList.size();
+    while (Processed < Num && Count < IN_MaxUnloads) {
+        fVector2i Pos = PendingUnloadList[Processed++];
+
+        // Chunk may have been unloaded or acquired again since it was scheduled
+        fUInt ChunkIndex = _Internal_GetChunkIndex(Pos.X, Pos.Y);
+        if (ChunkIndex == F_UINT_MAX) { continue; }
+        if (ChunkList[ChunkIndex]->GetTicketLevel() < F_UINT_MAX) { continue; }
+
+        if (UnloadChunk(ChunkIndex, true)) { Count++; }
+    }
+    PendingUnloadList.erase(PendingUnloadList.begin(), PendingUnloadList.begin() + Processed);
+
+    return Count;
+}
+fBool fVoxelWorld::UpdateChunkPool() {
+    if (!isInit) {
+        Log(F_LOG_SEV_ERROR,"FVoxelWorld","Unable to update chunk pool. World not yet initialised");
+        return false;
+    }
+
+    // Return idle BlockLists to the allocator
+    // If the budget has been lowered below the current usage, all cached BlockLists are released
+    fLong Time = _Internal_GetTimeMS() - (fLong)(ChunkPool_IdleTime * 1000.0F);
+    if (ChunkPool_MemoryBudget > 0 && ChunkPool_AllocatedBytes > ChunkPool_MemoryBudget) { Time = F_LONG_MAX; }
+    _Internal_FreeCachedBlockLists(Time);
+
+    // Min size may have been increased since init
+    fUInt MinChunks = _Internal_GetPoolMinChunks();
+    while (ChunksPerWorld < MinChunks) {
+        if (!_Internal_GrowChunkPool()) { break; }
+    }
+
+    // Only trailing slabs can be removed, otherwise chunk indices would change
+    while (ChunkSlabList.size() > 0) {
+        std::vector<fVoxelChunk>& Slab = ChunkSlabList.back();
+        fLong SlabNum = Slab.size();
+        if (ChunksPerWorld - SlabNum < MinChunks) { break; }
+
+        fBool isInUse = false;
+        for (fLong X = 0; X < SlabNum; X++) {
+            if (Slab[X].isExist || Slab[X].isAllocated) { isInUse = true; break; }
+        }
+        if (isInUse) { break; }
+
+        ChunkList.resize(ChunksPerWorld - SlabNum);
+        ChunkSlabList.pop_back();
+        ChunksPerWorld = ChunkList.size();
+
+        Log(F_LOG_SEV_DEBUG,"FVoxelWorld","Chunk pool shrunk to [" + std::to_string(ChunksPerWorld) + "] chunks");
+    }
+
+    return true;
+}
+fBool fVoxelWorld::SetVoxelMesh(std::vector<fProcMesh> IN_MeshList) {
     if (IN_MeshList.size() != 7) {
         Log(
             F_LOG_SEV_ERROR,
@@ -1022,6 +2072,56 @@ fBool fVoxelWorld::SetVoxelMesh(std::vector<fProcMesh> IN_MeshList) {
 
     return true;
 }
+void fVoxelWorld::SetIndexedMesh(fBool IN_isIndexed) {
+    if (isIndexedMesh == IN_isIndexed) { return; }
+    isIndexedMesh = IN_isIndexed;
+    _Internal_MarkAllMeshDirty();
+}
+void fVoxelWorld::SetPackedMesh(fBool IN_isPacked) {
+    if (isPackedMesh == IN_isPacked) { return; }
+    isPackedMesh = IN_isPacked;
+    _Internal_MarkAllMeshDirty();
+}
+void fVoxelWorld::SetAmbientOcclusion(fBool IN_isAmbientOcclusion) {
+    if (isAmbientOcclusion == IN_isAmbientOcclusion) { return; }
+    isAmbientOcclusion = IN_isAmbientOcclusion;
+    _Internal_MarkAllMeshDirty();
+}
+void fVoxelWorld::SetLighting(fBool IN_isLighting) {
+    if (isLighting == IN_isLighting) { return; }
+    isLighting = IN_isLighting;
+    _Internal_ResetLight();
+    _Internal_MarkAllMeshDirty();
+}
+fBool fVoxelWorld::LightChunk(fUInt IN_ChunkIndex) {
+    if (!isInit || !isLighting) { return false; }
+    if (IN_ChunkIndex >= ChunksPerWorld) { return false; }
+    if (!ChunkList[IN_ChunkIndex]->isExist) { return false; }
+
+    _Internal_RefreshChunkData(ChunkList[IN_ChunkIndex]);
+    _Internal_InitChunkLight(ChunkList[IN_ChunkIndex]);
+    return true;
+}
+void fVoxelWorld::UnpackVertex(const fVoxelPackedVertex& REF_Vertex, fVector3& OUT_Position, fVector3& OUT_Normal, fVector2& OUT_UV) {
+    OUT_Position.X = REF_Vertex.GetX() * VoxelSize_X;
+    OUT_Position.Y = REF_Vertex.GetY() * VoxelSize_Y;
+    OUT_Position.Z = REF_Vertex.GetZ() * VoxelSize_Z;
+
+    fUInt Face = REF_Vertex.GetFace();
+    OUT_Normal = {0.0F, 0.0F, 0.0F};
+    if (Face < 7 && VoxelMesh[Face].Normals.size() > 0) { OUT_Normal = VoxelMesh[Face].Normals[0]; }
+
+    fUInt Corner = REF_Vertex.GetCorner();
+    OUT_UV.X = (REF_Vertex.GetTileX() + (Corner & 1)) * TextureStep_X;
+    OUT_UV.Y = (REF_Vertex.GetTileY() + (Corner >> 1)) * TextureStep_Y;
+}
+void fVoxelWorld::_Internal_MarkAllMeshDirty() {
+    // Section meshes kept by "UpdateChunkMesh()" are in the old format
+    for (fUInt X = 0; X < ChunksPerWorld; X++) {
+        ChunkList[X]->isMeshDirty = true;
+        for (fUInt Y = 0; Y < ChunkList[X]->SectionList.size(); Y++) { ChunkList[X]->SectionList[Y].isMeshDirty = true; }
+    }
+}
 void fVoxelWorld::UseDefaultVoxelMesh() {
     const fVector3 CubeVertecies[8] = {
         /*0*/{0.0F,0.0F,0.0F},
@@ -1203,32 +2303,29 @@ void fVoxelWorld::UseDefaultVoxelMesh() {
 fVoxelLocalPos fVoxelWorld::GetVoxelLocalPos(fInt IN_GlobalX, fInt IN_GlobalY, fInt IN_GlobalZ) {
     fVoxelLocalPos Result;
 
-    Result.ChunkX = std::floor((fFloat)IN_GlobalX/(fFloat)ChunkSize_X);
-    if (IN_GlobalX >= 0) {
-        Result.LocalX = IN_GlobalX - (Result.ChunkX * (fInt)ChunkSize_X);
-    }
-    else {
-        Result.LocalX = IN_GlobalX * -1;
-        fInt TempX = ((Result.ChunkX * -1) - 1) * (fInt)ChunkSize_X;
-        Result.LocalX = (Result.LocalX  - TempX) - (fInt)ChunkSize_X;
-        Result.LocalX *= -1;
-    }
+    Result.ChunkX = ChunkDiv_X.Div(IN_GlobalX);
+    Result.LocalX = ChunkDiv_X.Mod(IN_GlobalX);
 
-    Result.ChunkZ = std::floor((fFloat)IN_GlobalZ/(fFloat)ChunkSize_Z);
-    if (IN_GlobalZ >= 0) {
-        Result.LocalZ = IN_GlobalZ - (Result.ChunkZ * (fInt)ChunkSize_Z);
-    }
-    else {
-        Result.LocalZ = IN_GlobalZ * -1;
-        fInt TempZ = ((Result.ChunkZ * -1) - 1) * (fInt)ChunkSize_Z;
-        Result.LocalZ = (Result.LocalZ  - TempZ) - (fInt)ChunkSize_Z;
-        Result.LocalZ *= -1;
-    }
+    Result.ChunkZ = ChunkDiv_Z.Div(IN_GlobalZ);
+    Result.LocalZ = ChunkDiv_Z.Mod(IN_GlobalZ);
 
     Result.LocalY = IN_GlobalY;
 
     return Result;
 }
+void fVoxelWorld::GetVoxelLocalPos(const fVoxelGlobalPos* IN_PosList, fVoxelLocalPos* OUT_PosList, size_t IN_Num) {
+    for (size_t X = 0; X < IN_Num; X++) {
+        OUT_PosList[X].ChunkX = ChunkDiv_X.Div(IN_PosList[X].GlobalX);
+        OUT_PosList[X].LocalX = ChunkDiv_X.Mod(IN_PosList[X].GlobalX);
+        OUT_PosList[X].ChunkZ = ChunkDiv_Z.Div(IN_PosList[X].GlobalZ);
+        OUT_PosList[X].LocalZ = ChunkDiv_Z.Mod(IN_PosList[X].GlobalZ);
+        OUT_PosList[X].LocalY = IN_PosList[X].GlobalY;
+    }
+}
+void fVoxelWorld::GetVoxelLocalPos(const fInt* IN_GlobalX, const fInt* IN_GlobalZ, fInt* OUT_ChunkX, fInt* OUT_ChunkZ, fInt* OUT_LocalX, fInt* OUT_LocalZ, size_t IN_Num) {
+    ChunkDiv_X.DivMod(IN_GlobalX, OUT_ChunkX, OUT_LocalX, IN_Num);
+    ChunkDiv_Z.DivMod(IN_GlobalZ, OUT_ChunkZ, OUT_LocalZ, IN_Num);
+}
 fVoxelGlobalPos fVoxelWorld::GetVoxelGlobalPos(fVoxelLocalPos IN_Pos) {
     fVoxelGlobalPos Result;
 
@@ -1243,6 +2340,8 @@ fVoxelGlobalPos fVoxelWorld::GetVoxelGlobalPos(fVoxelLocalPos IN_Pos) {
     return Result;
 }
 fUInt fVoxelWorld::GetVoxelIndex(fInt IN_X, fInt IN_Y, fInt IN_Z) {
+    if (!isInit) { return F_UINT_MAX; }
+
     // Calculate The Chunk This Voxel Belongs To
     fVoxelLocalPos Pos = GetVoxelLocalPos(IN_X, IN_Y, IN_Z);
 
@@ -1252,46 +2351,1523 @@ fUInt fVoxelWorld::GetVoxelIndex(fInt IN_X, fInt IN_Y, fInt IN_Z) {
         return F_UINT_MAX;
     }
 
-    fUInt VIndex = ChunkList[CIndex].GetVoxelIndex(Pos.LocalX, Pos.LocalY, Pos.LocalZ);
+    fUInt VIndex = ChunkList[CIndex]->GetVoxelIndex(Pos.LocalX, Pos.LocalY, Pos.LocalZ);
     if (VIndex == F_UINT_MAX) {
         return F_UINT_MAX;
     }
 
-    return ChunkList[CIndex].BlockList[VIndex];
+    return ChunkList[CIndex]->GetBlock(VIndex);
+}
+void fVoxelWorld::GetVoxels(const fVoxelGlobalPos* IN_PosList, fUInt* OUT_BlockList, size_t IN_Num) {
+    if (!isInit) {
+        for (size_t X = 0; X < IN_Num; X++) { OUT_BlockList[X] = F_UINT_MAX; }
+        return;
+    }
+
+    // Chunks already resolved by this call, bucketed by chunk position - Saves the ChunkMap lookups
+    fLong CacheKey[F_VOXEL_GET_VOXELS_CACHE];
+    fVoxelChunk* CacheChunk[F_VOXEL_GET_VOXELS_CACHE];
+    for (fUInt X = 0; X < F_VOXEL_GET_VOXELS_CACHE; X++) { CacheKey[X] = F_LONG_MAX; }
+
+    size_t X = 0;
+    while (X < IN_Num) {
+        const fVoxelGlobalPos& Pos = IN_PosList[X];
+        if (Pos.GlobalY < 0 || Pos.GlobalY >= (fInt)ChunkSize_Y) {
+            OUT_BlockList[X] = F_UINT_MAX;
+            X++;
+            continue;
+        }
+
+        fInt CX = ChunkDiv_X.Div(Pos.GlobalX);
+        fInt CZ = ChunkDiv_Z.Div(Pos.GlobalZ);
+        fLong Key = _Internal_GetChunkKey(CX, CZ);
+        fUInt Slot = (fUInt)((CX & 3) | ((CZ & 3) << 2)) & (F_VOXEL_GET_VOXELS_CACHE - 1);
+        if (CacheKey[Slot] != Key) {
+            CacheKey[Slot] = Key;
+            CacheChunk[Slot] = _Internal_FindChunk(CX, CZ);
+        }
+
+        fVoxelChunk* ChunkPtr = CacheChunk[Slot];
+        if (ChunkPtr == nullptr) {
+            OUT_BlockList[X] = F_UINT_MAX;
+            X++;
+            continue;
+        }
+        if (!ChunkPtr->isAllocated) {
+            OUT_BlockList[X] = ChunkPtr->UniformBlock;
+            X++;
+            continue;
+        }
+
+        fInt LocalX = ChunkDiv_X.Mod(Pos.GlobalX);
+        fUInt Index = ChunkPtr->GetVoxelIndex(LocalX, Pos.GlobalY, ChunkDiv_Z.Mod(Pos.GlobalZ));
+
+        // Following queries along X in the same row of the chunk are contiguous in BlockList
+        size_t Run = 1;
+        if (VoxelLayout == F_VOXEL_LAYOUT_LINEAR) {
+            size_t MaxRun = std::min(IN_Num - X, (size_t)(ChunkSize_X - LocalX));
+            while (Run < MaxRun) {
+                const fVoxelGlobalPos& NextPos = IN_PosList[X + Run];
+                if (NextPos.GlobalX != Pos.GlobalX + (fInt)Run || NextPos.GlobalY != Pos.GlobalY || NextPos.GlobalZ != Pos.GlobalZ) { break; }
+                Run++;
+            }
+        }
+
+        if (Run > 1) { std::memcpy(&OUT_BlockList[X], &ChunkPtr->BlockList[Index], Run * sizeof(fUInt)); }
+        else { OUT_BlockList[X] = ChunkPtr->BlockList[Index]; }
+        X += Run;
+    }
 }
 fBool fVoxelWorld::GenerateChunkMesh(fUInt IN_ChunkIndex, fProcMesh& OUT_Mesh) {
+    // Opaque faces go straight into OUT_Mesh, the other passes are appended after them
+    // Pass by pass, same order as "_Internal_SpliceSectionMeshes()"
+    for (fUInt P = 0; P < F_VOXEL_PASS_NUM - 1; P++) { fVoxel_ClearMesh(PassScratch[P]); }
+    fProcMesh* PassList[F_VOXEL_PASS_NUM] = { &OUT_Mesh, &PassScratch[0], &PassScratch[1] };
+    if (!_Internal_GenerateChunkMesh(IN_ChunkIndex, PassList)) { return false; }
+
+    for (fUInt P = 0; P < F_VOXEL_PASS_NUM - 1; P++) { OUT_Mesh += PassScratch[P]; }
+    return true;
+}
+fBool fVoxelWorld::GenerateChunkMesh(fUInt IN_ChunkIndex, fProcMesh OUT_MeshList[F_VOXEL_PASS_NUM]) {
+    fProcMesh* PassList[F_VOXEL_PASS_NUM] = { &OUT_MeshList[0], &OUT_MeshList[1], &OUT_MeshList[2] };
+    return _Internal_GenerateChunkMesh(IN_ChunkIndex, PassList);
+}
+fBool fVoxelWorld::_Internal_PrepareChunkMesh(fUInt IN_ChunkIndex, fBool& OUT_isEmpty) {
+    if (!isInit) { return false; }
+
+    if (IN_ChunkIndex >= ChunksPerWorld) { return false; }
+
+    _Internal_RefreshChunkData(ChunkList[IN_ChunkIndex]);
+
+    // First mesh of the chunk lits it - see "SetLighting()"
+    if (isLighting) { _Internal_InitChunkLight(ChunkList[IN_ChunkIndex]); }
+
+    ChunkList[IN_ChunkIndex]->VisibleVoxels = 0;
+
+    // Nothing to generate for an all Air chunk
+    OUT_isEmpty = !ChunkList[IN_ChunkIndex]->isAllocated && ChunkList[IN_ChunkIndex]->UniformBlock == F_UINT_MAX;
+    return true;
+}
+fBool fVoxelWorld::_Internal_GenerateChunkMesh(fUInt IN_ChunkIndex, fProcMesh* const* OUT_PassList) {
+    if (!_Internal_ValidateMeshFormat()) { return false; }
+
+    fBool isEmpty = false;
+    if (!_Internal_PrepareChunkMesh(IN_ChunkIndex, isEmpty)) { return false; }
+
+    for (fUInt X = 0; X < SectionsPerChunk && !isEmpty; X++) {
+        ChunkList[IN_ChunkIndex]->VisibleVoxels += _Internal_GenerateSectionMesh(IN_ChunkIndex, X, OUT_PassList);
+    }
+
+    ChunkList[IN_ChunkIndex]->isMeshGenerated = true;
+    ChunkList[IN_ChunkIndex]->isMeshDirty = false;
+    return true;
+}
+fBool fVoxelWorld::GenerateChunkMesh(fUInt IN_ChunkIndex, fVoxelMeshSink& REF_Sink) {
+    fBool isEmpty = false;
+    if (!_Internal_PrepareChunkMesh(IN_ChunkIndex, isEmpty)) { return false; }
+
+    for (fUInt X = 0; X < SectionsPerChunk && !isEmpty; X++) {
+        fUInt Num = _Internal_GenerateSectionMesh(IN_ChunkIndex, X, nullptr, &REF_Sink);
+        if (Num == F_UINT_MAX) {
+            Log(F_LOG_SEV_ERROR,"FVoxelWorld","Unable to generate chunk mesh. Mesh sink is full.");
+            return false;
+        }
+        ChunkList[IN_ChunkIndex]->VisibleVoxels += Num;
+    }
+
+    ChunkList[IN_ChunkIndex]->isMeshGenerated = true;
+    ChunkList[IN_ChunkIndex]->isMeshDirty = false;
+    return true;
+}
+fBool fVoxelWorld::UpdateChunkMesh(fUInt IN_ChunkIndex, fProcMesh& OUT_Mesh) {
+    if (!_Internal_UpdateSectionMeshes(IN_ChunkIndex)) { return false; }
+
+    _Internal_SpliceSectionMeshes(ChunkList[IN_ChunkIndex], F_UINT_MAX, OUT_Mesh);
+    return true;
+}
+fBool fVoxelWorld::UpdateChunkMesh(fUInt IN_ChunkIndex, fProcMesh OUT_MeshList[F_VOXEL_PASS_NUM]) {
+    if (!_Internal_UpdateSectionMeshes(IN_ChunkIndex)) { return false; }
+
+    for (fUInt P = 0; P < F_VOXEL_PASS_NUM; P++) { _Internal_SpliceSectionMeshes(ChunkList[IN_ChunkIndex], P, OUT_MeshList[P]); }
+    return true;
+}
+fBool fVoxelWorld::_Internal_UpdateSectionMeshes(fUInt IN_ChunkIndex) {
     if (!isInit) { return false; }
 
     if (IN_ChunkIndex >= ChunksPerWorld) { return false; }
 
+    fVoxelChunk* ChunkPtr = ChunkList[IN_ChunkIndex];
+    if (!ChunkPtr->isExist) { return false; }
+    if (!_Internal_ValidateMeshFormat()) { return false; }
+
+    _Internal_RefreshChunkData(ChunkPtr);
+
+    // First mesh of the chunk lits it - see "SetLighting()"
+    if (isLighting) { _Internal_InitChunkLight(ChunkList[IN_ChunkIndex]); }
+
+    fBool isAir = !ChunkPtr->isAllocated && ChunkPtr->UniformBlock == F_UINT_MAX;
+
+    ChunkPtr->VisibleVoxels = 0;
+    for (fUInt X = 0; X < SectionsPerChunk; X++) {
+        fVoxelSection& Section = ChunkPtr->SectionList[X];
+
+        if (Section.isMeshDirty) {
+            fProcMesh* PassList[F_VOXEL_PASS_NUM];
+            for (fUInt P = 0; P < F_VOXEL_PASS_NUM; P++) {
+                Section.PassMesh[P] = fProcMesh();
+                PassList[P] = &Section.PassMesh[P];
+            }
+
+            Section.VisibleVoxels = 0;
+            if (!isAir) { Section.VisibleVoxels = _Internal_GenerateSectionMesh(IN_ChunkIndex, X, PassList); }
+            Section.MeshID = ++LastSectionMeshID;
+            Section.isMeshDirty = false;
+        }
+
+        ChunkPtr->VisibleVoxels += Section.VisibleVoxels;
+    }
+
+    ChunkPtr->isMeshGenerated = true;
+    ChunkPtr->isMeshDirty = false;
+    return true;
+}
+void fVoxelWorld::_Internal_SpliceSectionMeshes(fVoxelChunk* IN_Chunk, fUInt IN_Pass, fProcMesh& REF_Mesh) {
+    fUInt MinPass = IN_Pass == F_UINT_MAX ? 0 : IN_Pass;
+    fUInt MaxPass = IN_Pass == F_UINT_MAX ? F_VOXEL_PASS_NUM - 1 : IN_Pass;
+    fVoxelSpliceState& State = IN_Chunk->SpliceList[IN_Pass == F_UINT_MAX ? F_VOXEL_PASS_NUM : IN_Pass];
+    fUInt EntryNum = (MaxPass - MinPass + 1) * SectionsPerChunk;
+
+    // REF_Mesh can only be patched if it still holds exactly what the last splice left in it
+    fBool isPatch = State.Mesh == &REF_Mesh && State.EntryList.size() == EntryNum;
+    if (isPatch) {
+        auto It = SpliceOwnerMap.find(&REF_Mesh);
+        isPatch = It != SpliceOwnerMap.end() && It->second == &State;
+    }
+    if (isPatch) {
+        fUInt Total[F_VOXEL_MESH_LIST_NUM] = {0};
+        for (fUInt X = 0; X < EntryNum; X++) {
+            for (fUInt L = 0; L < F_VOXEL_MESH_LIST_NUM; L++) { Total[L] += State.EntryList[X].Size[L]; }
+        }
+        fUInt Size[F_VOXEL_MESH_LIST_NUM];
+        fVoxel_GetMeshSize(REF_Mesh, Size);
+        for (fUInt L = 0; L < F_VOXEL_MESH_LIST_NUM; L++) { isPatch = isPatch && Total[L] == Size[L]; }
+    }
+
+    if (isPatch) {
+        // Start of the current section mesh in each list of REF_Mesh
+        fUInt Start[F_VOXEL_MESH_LIST_NUM] = {0};
+        fUInt E = 0;
+        for (fUInt P = MinPass; P <= MaxPass; P++) {
+            for (fUInt X = 0; X < SectionsPerChunk; X++, E++) {
+                const fVoxelSection& Section = IN_Chunk->SectionList[X];
+                const fProcMesh& Mesh = Section.PassMesh[P];
+                fVoxelSpliceEntry& Entry = State.EntryList[E];
+
+                if (Entry.MeshID != Section.MeshID) {
+                    fVoxel_ReplaceRange(REF_Mesh.Vertecies, Start[0], Entry.Size[0], Mesh.Vertecies);
+                    fVoxel_ReplaceRange(REF_Mesh.Normals, Start[1], Entry.Size[1], Mesh.Normals);
+                    fVoxel_ReplaceRange(REF_Mesh.UVs, Start[2], Entry.Size[2], Mesh.UVs);
+                    fVoxel_ReplaceRange(REF_Mesh.AO, Start[3], Entry.Size[3], Mesh.AO);
+                    fVoxel_ReplaceRange(REF_Mesh.Colors, Start[4], Entry.Size[4], Mesh.Colors);
+                    fVoxel_ReplaceRange(REF_Mesh.Packed, Start[5], Entry.Size[5], Mesh.Packed);
+                    fVoxel_ReplaceRange(REF_Mesh.Indices, Start[6], Entry.Size[6], Mesh.Indices);
+
+                    // Indices of the section are offset by the vertices before it,
+                    // the ones after it by the change in the number of vertices of the section
+                    fUInt VertexStart = Start[0] + Start[5];
+                    fUInt VertexDelta = Mesh.GetVertexNum() - (Entry.Size[0] + Entry.Size[5]);
+                    fUInt IndexEnd = Start[6] + Mesh.Indices.size();
+                    for (fUInt I = Start[6]; I < IndexEnd; I++) { REF_Mesh.Indices[I] += VertexStart; }
+                    if (VertexDelta != 0) {
+                        for (fUInt I = IndexEnd; I < REF_Mesh.Indices.size(); I++) { REF_Mesh.Indices[I] += VertexDelta; }
+                    }
+
+                    Entry.MeshID = Section.MeshID;
+                    fVoxel_GetMeshSize(Mesh, Entry.Size);
+                }
+
+                for (fUInt L = 0; L < F_VOXEL_MESH_LIST_NUM; L++) { Start[L] += Entry.Size[L]; }
+            }
+        }
+        return;
+    }
+
+    _Internal_ResetSpliceState(State);
+    REF_Mesh = fProcMesh();
+    State.Mesh = &REF_Mesh;
+    State.EntryList.resize(EntryNum);
+    SpliceOwnerMap[&REF_Mesh] = &State;
+
+    fUInt Total[F_VOXEL_MESH_LIST_NUM] = {0};
+    fUInt E = 0;
+    for (fUInt P = MinPass; P <= MaxPass; P++) {
+        for (fUInt X = 0; X < SectionsPerChunk; X++, E++) {
+            fVoxelSpliceEntry& Entry = State.EntryList[E];
+            Entry.MeshID = IN_Chunk->SectionList[X].MeshID;
+            fVoxel_GetMeshSize(IN_Chunk->SectionList[X].PassMesh[P], Entry.Size);
+            for (fUInt L = 0; L < F_VOXEL_MESH_LIST_NUM; L++) { Total[L] += Entry.Size[L]; }
+        }
+    }
+
+    REF_Mesh.Vertecies.reserve(Total[0]);
+    REF_Mesh.Normals.reserve(Total[1]);
+    REF_Mesh.UVs.reserve(Total[2]);
+    REF_Mesh.AO.reserve(Total[3]);
+    REF_Mesh.Colors.reserve(Total[4]);
+    REF_Mesh.Packed.reserve(Total[5]);
+    REF_Mesh.Indices.reserve(Total[6]);
+
+    // Pass by pass, so renderers can draw each pass as a range of the mesh
+    for (fUInt P = MinPass; P <= MaxPass; P++) {
+        for (fUInt X = 0; X < SectionsPerChunk; X++) { REF_Mesh += IN_Chunk->SectionList[X].PassMesh[P]; }
+    }
+}
+void fVoxelWorld::_Internal_ResetSpliceState(fVoxelSpliceState& REF_State) {
+    auto It = SpliceOwnerMap.find(REF_State.Mesh);
+    if (It != SpliceOwnerMap.end() && It->second == &REF_State) { SpliceOwnerMap.erase(It); }
+
+    REF_State = fVoxelSpliceState();
+}
+fProcMesh* fVoxelWorld::GetSectionMesh(fUInt IN_ChunkIndex, fUInt IN_SectionIndex, fUInt IN_Pass) {
+    if (IN_ChunkIndex >= ChunksPerWorld) { return nullptr; }
+    if (IN_SectionIndex >= SectionsPerChunk) { return nullptr; }
+    if (IN_Pass >= F_VOXEL_PASS_NUM) { return nullptr; }
+
+    return &ChunkList[IN_ChunkIndex]->SectionList[IN_SectionIndex].PassMesh[IN_Pass];
+}
+fUInt fVoxelWorld::_Internal_GenerateSectionMesh(fUInt IN_ChunkIndex, fUInt IN_SectionIndex, fProcMesh* const* OUT_PassList, fVoxelMeshSink* IN_Sink) {
+    fUInt Result = 0;
+    fUInt MinY = IN_SectionIndex * F_VOXEL_SECTION_SIZE_Y;
+    fUInt MaxY = std::min(MinY + F_VOXEL_SECTION_SIZE_Y, ChunkSize_Y);
+
+    // Nothing but Air above the highest voxel of the chunk
+    fInt MaxHeight = ChunkList[IN_ChunkIndex]->MaxHeight;
+    if ((fInt)MinY > MaxHeight) { return 0; }
+    MaxY = std::min(MaxY, (fUInt)MaxHeight + 1);
+
+    // All Air, or buried in opaque voxels
+    if (_Internal_GetisSectionHidden(ChunkList[IN_ChunkIndex], IN_SectionIndex)) { return 0; }
+
+    const fUInt* Padded = _Internal_GatherSection(IN_ChunkIndex, IN_SectionIndex);
+    if (isLighting) { _Internal_GatherSectionLight(IN_ChunkIndex, IN_SectionIndex); }
+
+    // Sink only takes float vertices, written one voxel at a time
+    const fProcMesh* FaceMesh = IN_Sink == nullptr ? _Internal_GetFaceMeshes() : VoxelMesh;
+
     fVoxelLocalPos LPos;
-    LPos.ChunkX = ChunkList[IN_ChunkIndex].PosX;
-    LPos.ChunkZ = ChunkList[IN_ChunkIndex].PosZ;
+    LPos.ChunkX = ChunkList[IN_ChunkIndex]->PosX;
+    LPos.ChunkZ = ChunkList[IN_ChunkIndex]->PosZ;
 
-    for (fUInt Y = 0; Y < ChunkSize_Y; Y++) {
+    for (fUInt Y = MinY; Y < MaxY; Y++) {
         LPos.LocalY = Y;
 
         for (fUInt Z = 0; Z < ChunkSize_Z; Z++) {
             LPos.LocalZ = Z;
+            fUInt PadIndex = (((Y - MinY + 1) * MeshPad_Z) + Z + 1) * MeshPad_X + 1;
+
+            for (fUInt X = 0; X < ChunkSize_X; X++, PadIndex++) {
+                if (Padded[PadIndex] == F_UINT_MAX) { continue; }
 
-            for (fUInt X = 0; X < ChunkSize_X; X++) {
                 LPos.LocalX = X;
+                if (IN_Sink != nullptr) {
+                    SinkScratch.Vertecies.clear();
+                    SinkScratch.Normals.clear();
+                    SinkScratch.UVs.clear();
+                    SinkScratch.AO.clear();
+                    SinkScratch.Colors.clear();
+                }
+
+                fProcMesh& Target = IN_Sink == nullptr ? *OUT_PassList[BlockRegistry.GetPass(Padded[PadIndex])] : SinkScratch;
+                if (!_Internal_GenerateVoxel(Padded, PadIndex, LPos, FaceMesh, Target)) { continue; }
+                Result++;
+
+                if (IN_Sink != nullptr && !_Internal_WriteSink(*IN_Sink, SinkScratch)) { return F_UINT_MAX; }
+            }
+        }
+    }
+
+    return Result;
+}
+const fProcMesh* fVoxelWorld::_Internal_GetFaceMeshes() {
+    if (isPackedMesh) { return isIndexedMesh ? VoxelMeshPackedIndexed : VoxelMeshPacked; }
+    return isIndexedMesh ? VoxelMeshIndexed : VoxelMesh;
+}
+fBool fVoxelWorld::_Internal_WriteSink(fVoxelMeshSink& REF_Sink, const fProcMesh& REF_Mesh) {
+    fUInt Num = REF_Mesh.Vertecies.size();
+    if (REF_Sink.VertexNum + Num > REF_Sink.Capacity) {
+        if (REF_Sink.OnFull == nullptr || !REF_Sink.OnFull(REF_Sink, Num)) { return false; }
+        if (REF_Sink.VertexNum + Num > REF_Sink.Capacity) { return false; }
+    }
+
+    fUInt PStride = REF_Sink.Position.Stride > 0 ? REF_Sink.Position.Stride : sizeof(fFloat) * 3;
+    fUInt NStride = REF_Sink.Normal.Stride > 0 ? REF_Sink.Normal.Stride : sizeof(fFloat) * 3;
+    fUInt UStride = REF_Sink.UV.Stride > 0 ? REF_Sink.UV.Stride : sizeof(fFloat) * 2;
+    fBool isNormals = REF_Sink.Normal.Data != nullptr && REF_Mesh.Normals.size() == Num;
+    fBool isUVs = REF_Sink.UV.Data != nullptr && REF_Mesh.UVs.size() == Num;
+    fUInt AStride = REF_Sink.AO.Stride > 0 ? REF_Sink.AO.Stride : sizeof(fFloat);
+    fBool isAO = REF_Sink.AO.Data != nullptr && REF_Mesh.AO.size() == Num;
+    fUInt CStride = REF_Sink.Color.Stride > 0 ? REF_Sink.Color.Stride : sizeof(fVoxelColor);
+    fBool isColors = REF_Sink.Color.Data != nullptr && REF_Mesh.Colors.size() == Num;
+
+    for (fUInt X = 0; X < Num; X++) {
+        fLong V = REF_Sink.VertexNum + X;
+
+        if (REF_Sink.Position.Data != nullptr) {
+            fFloat* Dst = (fFloat*)((fUChar*)REF_Sink.Position.Data + REF_Sink.Position.Offset + (V * PStride));
+            Dst[0] = REF_Mesh.Vertecies[X].X;
+            Dst[1] = REF_Mesh.Vertecies[X].Y;
+            Dst[2] = REF_Mesh.Vertecies[X].Z;
+        }
+        if (isNormals) {
+            fFloat* Dst = (fFloat*)((fUChar*)REF_Sink.Normal.Data + REF_Sink.Normal.Offset + (V * NStride));
+            Dst[0] = REF_Mesh.Normals[X].X;
+            Dst[1] = REF_Mesh.Normals[X].Y;
+            Dst[2] = REF_Mesh.Normals[X].Z;
+        }
+        if (isUVs) {
+            fFloat* Dst = (fFloat*)((fUChar*)REF_Sink.UV.Data + REF_Sink.UV.Offset + (V * UStride));
+            Dst[0] = REF_Mesh.UVs[X].X;
+            Dst[1] = REF_Mesh.UVs[X].Y;
+        }
+        if (isAO) {
+            fFloat* Dst = (fFloat*)((fUChar*)REF_Sink.AO.Data + REF_Sink.AO.Offset + (V * AStride));
+            Dst[0] = REF_Mesh.AO[X] / 3.0F;
+        }
+        if (isColors) {
+            fUChar* Dst = (fUChar*)REF_Sink.Color.Data + REF_Sink.Color.Offset + (V * CStride);
+            Dst[0] = REF_Mesh.Colors[X].R;
+            Dst[1] = REF_Mesh.Colors[X].G;
+            Dst[2] = REF_Mesh.Colors[X].B;
+            Dst[3] = REF_Mesh.Colors[X].A;
+        }
+    }
+
+    REF_Sink.VertexNum += Num;
+    return true;
+}
+const fUInt* fVoxelWorld::_Internal_GatherSection(fUInt IN_ChunkIndex, fUInt IN_SectionIndex) {
+    fVoxelChunk* ChunkPtr = ChunkList[IN_ChunkIndex];
+    fUInt Size = MeshPad_X * (F_VOXEL_SECTION_SIZE_Y + 2) * MeshPad_Z;
+
+    // Everything not copied below (outside of Y bounds, chunks not loaded) is Air
+    MeshScratch.resize(Size);
+    std::fill_n(MeshScratch.data(), Size, F_UINT_MAX);
+
+    fVoxelChunk** NeighbourList = ChunkPtr->NeighbourList;
+
+    fInt MinY = (fInt)(IN_SectionIndex * F_VOXEL_SECTION_SIZE_Y) - 1;
+    for (fUInt PY = 0; PY < F_VOXEL_SECTION_SIZE_Y + 2; PY++) {
+        fInt Y = MinY + (fInt)PY;
+        if (Y < 0 || Y >= (fInt)ChunkSize_Y) { continue; }
+
+        fUInt* Layer = MeshScratch.data() + (PY * MeshPad_Z * MeshPad_X);
+
+        // Chunk itself
+        for (fUInt Z = 0; Z < ChunkSize_Z; Z++) {
+            _Internal_CopyRow(ChunkPtr, Y, Z, Layer + ((Z + 1) * MeshPad_X) + 1);
+        }
+
+        // One voxel halo from the neighbours
+        if (NeighbourList[F_VOXEL_NEIGHBOUR_FRONT] != nullptr) { _Internal_CopyRow(NeighbourList[F_VOXEL_NEIGHBOUR_FRONT], Y, ChunkSize_Z - 1, Layer + 1); }
+        if (NeighbourList[F_VOXEL_NEIGHBOUR_BACK] != nullptr) { _Internal_CopyRow(NeighbourList[F_VOXEL_NEIGHBOUR_BACK], Y, 0, Layer + ((ChunkSize_Z + 1) * MeshPad_X) + 1); }
+        for (fUInt Z = 0; Z < ChunkSize_Z; Z++) {
+            fUInt* Row = Layer + ((Z + 1) * MeshPad_X);
+            if (NeighbourList[F_VOXEL_NEIGHBOUR_LEFT] != nullptr) { Row[ChunkSize_X + 1] = NeighbourList[F_VOXEL_NEIGHBOUR_LEFT]->GetBlock(NeighbourList[F_VOXEL_NEIGHBOUR_LEFT]->GetVoxelIndex(0, Y, Z)); }
+            if (NeighbourList[F_VOXEL_NEIGHBOUR_RIGHT] != nullptr) { Row[0] = NeighbourList[F_VOXEL_NEIGHBOUR_RIGHT]->GetBlock(NeighbourList[F_VOXEL_NEIGHBOUR_RIGHT]->GetVoxelIndex(ChunkSize_X - 1, Y, Z)); }
+        }
+
+        // Corners from the diagonal chunks - Only seen by the ambient occlusion
+        for (fUInt C = 0; C < 4; C++) {
+            fVoxelChunk* DiagonalPtr = _Internal_GetDiagonal(ChunkPtr, C);
+            if (DiagonalPtr == nullptr) { continue; }
+
+            fUInt LX = (C & 1) ? 0 : ChunkSize_X - 1;
+            fUInt LZ = (C & 2) ? 0 : ChunkSize_Z - 1;
+            fUInt PX = (C & 1) ? ChunkSize_X + 1 : 0;
+            fUInt PZ = (C & 2) ? ChunkSize_Z + 1 : 0;
+            Layer[(PZ * MeshPad_X) + PX] = DiagonalPtr->GetBlock(DiagonalPtr->GetVoxelIndex(LX, Y, LZ));
+        }
+    }
+
+    return MeshScratch.data();
+}
+void fVoxelWorld::_Internal_CopyRow(fVoxelChunk* IN_Chunk, fUInt IN_Y, fUInt IN_Z, fUInt* OUT_Row) {
+    if (!IN_Chunk->isAllocated) {
+        std::fill_n(OUT_Row, ChunkSize_X, IN_Chunk->UniformBlock);
+        return;
+    }
+
+    // X rows are contiguous
+    if (VoxelLayout == F_VOXEL_LAYOUT_LINEAR) {
+        std::memcpy(OUT_Row, IN_Chunk->BlockList + IN_Chunk->GetVoxelIndex(0, IN_Y, IN_Z), sizeof(fUInt) * ChunkSize_X);
+        return;
+    }
+
+    for (fUInt X = 0; X < ChunkSize_X; X++) { OUT_Row[X] = IN_Chunk->BlockList[IN_Chunk->GetVoxelIndex(X, IN_Y, IN_Z)]; }
+}
+void fVoxelWorld::_Internal_MarkNeighboursDirty(fVoxelChunk* IN_Chunk) {
+    // Diagonal chunks see the corner voxels through the ambient occlusion
+    fVoxelChunk* DirtyList[F_VOXEL_NEIGHBOUR_NUM + 4];
+    for (fUInt N = 0; N < F_VOXEL_NEIGHBOUR_NUM; N++) { DirtyList[N] = IN_Chunk->NeighbourList[N]; }
+    for (fUInt C = 0; C < 4; C++) { DirtyList[F_VOXEL_NEIGHBOUR_NUM + C] = isAmbientOcclusion ? _Internal_GetDiagonal(IN_Chunk, C) : nullptr; }
+
+    for (fUInt N = 0; N < F_VOXEL_NEIGHBOUR_NUM + 4; N++) {
+        fVoxelChunk* NeighbourPtr = DirtyList[N];
+        if (NeighbourPtr == nullptr) { continue; }
+
+        NeighbourPtr->isMeshDirty = true;
+        for (fUInt X = 0; X < SectionsPerChunk; X++) { NeighbourPtr->SectionList[X].isMeshDirty = true; }
+    }
+}
+fVoxelChunk* fVoxelWorld::_Internal_GetDiagonal(fVoxelChunk* IN_Chunk, fUInt IN_Corner) {
+    fUInt NX = (IN_Corner & 1) ? F_VOXEL_NEIGHBOUR_LEFT : F_VOXEL_NEIGHBOUR_RIGHT;
+    fUInt NZ = (IN_Corner & 2) ? F_VOXEL_NEIGHBOUR_BACK : F_VOXEL_NEIGHBOUR_FRONT;
+
+    // Either path works, one of the 2 chunks in between may not be loaded
+    if (IN_Chunk->NeighbourList[NZ] != nullptr && IN_Chunk->NeighbourList[NZ]->NeighbourList[NX] != nullptr) { return IN_Chunk->NeighbourList[NZ]->NeighbourList[NX]; }
+    if (IN_Chunk->NeighbourList[NX] != nullptr) { return IN_Chunk->NeighbourList[NX]->NeighbourList[NZ]; }
+    return nullptr;
+}
+void fVoxelWorld::_Internal_LinkNeighbours(fVoxelChunk* IN_Chunk) {
+    for (fUInt N = 0; N < F_VOXEL_NEIGHBOUR_NUM; N++) {
+        fUInt NIndex = _Internal_GetChunkIndex(IN_Chunk->PosX + fVoxel_NeighbourOffset[N][0], IN_Chunk->PosZ + fVoxel_NeighbourOffset[N][1]);
+        if (NIndex == F_UINT_MAX) {
+            IN_Chunk->NeighbourList[N] = nullptr;
+            continue;
+        }
+
+        IN_Chunk->NeighbourList[N] = ChunkList[NIndex];
+        ChunkList[NIndex]->NeighbourList[N ^ 1] = IN_Chunk;
+    }
+}
+void fVoxelWorld::_Internal_UnlinkNeighbours(fVoxelChunk* IN_Chunk) {
+    for (fUInt N = 0; N < F_VOXEL_NEIGHBOUR_NUM; N++) {
+        if (IN_Chunk->NeighbourList[N] != nullptr) { IN_Chunk->NeighbourList[N]->NeighbourList[N ^ 1] = nullptr; }
+        IN_Chunk->NeighbourList[N] = nullptr;
+    }
+}
+void fVoxelWorld::_Internal_BuildHeightmap(fVoxelChunk* IN_Chunk) {
+    fUInt Num = ChunkSize_X * ChunkSize_Z;
+    IN_Chunk->SolidHeightList.assign(Num, -1);
+    IN_Chunk->TopHeightList.assign(Num, -1);
+    IN_Chunk->MaxHeight = -1;
+    IN_Chunk->isHeightmapDirty = false;
+
+    // Uniform chunk - Every column is the same
+    if (!IN_Chunk->isAllocated) {
+        if (IN_Chunk->UniformBlock == F_UINT_MAX) { return; }
+
+        std::fill_n(IN_Chunk->TopHeightList.data(), Num, (fInt)ChunkSize_Y - 1);
+        IN_Chunk->MaxHeight = (fInt)ChunkSize_Y - 1;
+        if (BlockRegistry.GetisSolid(IN_Chunk->UniformBlock)) { std::fill_n(IN_Chunk->SolidHeightList.data(), Num, (fInt)ChunkSize_Y - 1); }
+        return;
+    }
+
+    _Internal_UpdateHeightmap(IN_Chunk, 0, 0, ChunkSize_X - 1, ChunkSize_Y - 1, ChunkSize_Z - 1);
+}
+void fVoxelWorld::_Internal_UpdateHeightmap(fVoxelChunk* IN_Chunk, fInt IN_MinX, fInt IN_MinZ, fInt IN_MaxX, fInt IN_MaxY, fInt IN_MaxZ) {
+    // Max height only needs a full scan if a column holding it got lower
+    fInt OldMax = IN_Chunk->MaxHeight;
+    fInt NewMax = OldMax;
+    fBool isRescan = false;
+
+    for (fInt Z = IN_MinZ; Z <= IN_MaxZ; Z++) {
+        for (fInt X = IN_MinX; X <= IN_MaxX; X++) {
+            fUInt Column = (Z * ChunkSize_X) + X;
+            fInt& Solid = IN_Chunk->SolidHeightList[Column];
+            fInt& Top = IN_Chunk->TopHeightList[Column];
+            fInt OldTop = Top;
+
+            // Voxels above the box did not change - Below the current heights an edit can not move them
+            fBool isSolid = IN_MaxY >= Solid;
+            fBool isTop = IN_MaxY >= Top;
+            if (isSolid) { Solid = -1; }
+            if (isTop) { Top = -1; }
+
+            for (fInt Y = IN_MaxY; Y >= 0 && (isSolid || isTop); Y--) {
+                fUInt ID = IN_Chunk->GetBlock(IN_Chunk->GetVoxelIndex(X, Y, Z));
+                if (ID == F_UINT_MAX) { continue; }
+
+                if (isTop) {
+                    Top = Y;
+                    isTop = false;
+                }
+                if (isSolid && BlockRegistry.GetisSolid(ID)) {
+                    Solid = Y;
+                    isSolid = false;
+                }
+            }
+
+            NewMax = std::max(NewMax, Top);
+            if (OldTop == OldMax && Top < OldTop) { isRescan = true; }
+        }
+    }
+
+    IN_Chunk->MaxHeight = isRescan ? _Internal_GetMaxHeight(IN_Chunk) : NewMax;
+}
+void fVoxelWorld::_Internal_RefreshChunkData(fVoxelChunk* IN_Chunk) {
+    if (IN_Chunk->isHeightmapDirty) { _Internal_BuildHeightmap(IN_Chunk); }
+    if (IN_Chunk->isOccupancyDirty) { _Internal_BuildOccupancy(IN_Chunk); }
+}
+fInt fVoxelWorld::_Internal_GetMaxHeight(fVoxelChunk* IN_Chunk) {
+    fInt Result = -1;
+    for (fUInt X = 0; X < IN_Chunk->TopHeightList.size(); X++) { Result = std::max(Result, IN_Chunk->TopHeightList[X]); }
+    return Result;
+}
+fBool fVoxelWorld::UpdateChunkHeightmap(fUInt IN_ChunkIndex) {
+    if (!isInit) { return false; }
+    if (IN_ChunkIndex >= ChunksPerWorld || !ChunkList[IN_ChunkIndex]->isExist) { return false; }
+
+    _Internal_BuildHeightmap(ChunkList[IN_ChunkIndex]);
+    return true;
+}
+// Adds IN_Num (may be negative) voxels of IN_BlockID to a list of {Count,ID} pairs - Drops pairs reaching 0
+static void fVoxel_AddBlockCount(std::vector<fVector2ui>& REF_List, fUInt IN_BlockID, fInt IN_Num) {
+    for (fUInt X = 0; X < REF_List.size(); X++) {
+        if (REF_List[X].Y != IN_BlockID) { continue; }
+
+        REF_List[X].X += IN_Num;
+        if (REF_List[X].X == 0) {
+            REF_List[X] = REF_List.back();
+            REF_List.pop_back();
+        }
+        return;
+    }
+    if (IN_Num > 0) { REF_List.push_back({ (fUInt)IN_Num, IN_BlockID }); }
+}
+void fVoxelWorld::_Internal_BuildOccupancy(fVoxelChunk* IN_Chunk, fUInt IN_MinSection, fUInt IN_MaxSection) {
+    IN_MaxSection = std::min(IN_MaxSection, SectionsPerChunk - 1);
+    if (IN_MinSection == 0 && IN_MaxSection == SectionsPerChunk - 1) { IN_Chunk->isOccupancyDirty = false; }
+    fUInt LayerNum = ChunkSize_X * ChunkSize_Z;
+
+    for (fUInt S = IN_MinSection; S <= IN_MaxSection; S++) {
+        fVoxelSection& Section = IN_Chunk->SectionList[S];
+        fUInt MinY = S * F_VOXEL_SECTION_SIZE_Y;
+        fUInt MaxY = std::min(MinY + F_VOXEL_SECTION_SIZE_Y, ChunkSize_Y);
+
+        Section.VoxelNum = (MaxY - MinY) * LayerNum;
+        Section.SolidBits.assign((Section.VoxelNum + 31) / 32, 0);
+        Section.SolidCount = 0;
+        Section.OpaqueCount = 0;
+        Section.BlockCountList.clear();
+
+        // Uniform chunk - Every voxel is the same
+        if (!IN_Chunk->isAllocated) {
+            fUInt ID = IN_Chunk->UniformBlock;
+            Section.BlockCountList.push_back({ Section.VoxelNum, ID });
+            if (BlockRegistry.GetisOpaque(ID)) { Section.OpaqueCount = Section.VoxelNum; }
+            if (BlockRegistry.GetisSolid(ID)) {
+                Section.SolidCount = Section.VoxelNum;
+                std::fill(Section.SolidBits.begin(), Section.SolidBits.end(), F_UINT_MAX);
+            }
+            continue;
+        }
+
+        // Runs of the same block are counted at once
+        fUInt RunID = F_UINT_MAX;
+        fUInt RunNum = 0;
+        fUInt Bit = 0;
+        for (fUInt Y = MinY; Y < MaxY; Y++) {
+            for (fUInt Z = 0; Z < ChunkSize_Z; Z++) {
+                for (fUInt X = 0; X < ChunkSize_X; X++, Bit++) {
+                    fUInt ID = IN_Chunk->BlockList[IN_Chunk->GetVoxelIndex(X, Y, Z)];
+                    if (ID != RunID) {
+                        if (RunNum > 0) { fVoxel_AddBlockCount(Section.BlockCountList, RunID, RunNum); }
+                        RunID = ID;
+                        RunNum = 0;
+                    }
+                    RunNum++;
+
+                    if (BlockRegistry.GetisOpaque(ID)) { Section.OpaqueCount++; }
+                    if (!BlockRegistry.GetisSolid(ID)) { continue; }
+                    Section.SolidBits[Bit >> 5] |= 1u << (Bit & 31);
+                    Section.SolidCount++;
+                }
+            }
+        }
+        if (RunNum > 0) { fVoxel_AddBlockCount(Section.BlockCountList, RunID, RunNum); }
+    }
+}
+void fVoxelWorld::_Internal_CountVoxel(fVoxelChunk* IN_Chunk, fUInt IN_X, fUInt IN_Y, fUInt IN_Z, fUInt IN_OldID, fUInt IN_NewID) {
+    fVoxelSection& Section = IN_Chunk->SectionList[IN_Y / F_VOXEL_SECTION_SIZE_Y];
+    fVoxel_AddBlockCount(Section.BlockCountList, IN_OldID, -1);
+    fVoxel_AddBlockCount(Section.BlockCountList, IN_NewID, 1);
+
+    Section.OpaqueCount += (fInt)BlockRegistry.GetisOpaque(IN_NewID) - (fInt)BlockRegistry.GetisOpaque(IN_OldID);
+
+    fBool isSolid = BlockRegistry.GetisSolid(IN_NewID);
+    if (isSolid == BlockRegistry.GetisSolid(IN_OldID)) { return; }
+
+    fUInt Bit = _Internal_GetSectionBit(IN_X, IN_Y, IN_Z);
+    if (isSolid) {
+        Section.SolidBits[Bit >> 5] |= 1u << (Bit & 31);
+        Section.SolidCount++;
+    }
+    else {
+        Section.SolidBits[Bit >> 5] &= ~(1u << (Bit & 31));
+        Section.SolidCount--;
+    }
+}
+fBool fVoxelWorld::_Internal_GetisSectionHidden(fVoxelChunk* IN_Chunk, fUInt IN_SectionIndex) {
+    // Occupancy not built yet
+    const fVoxelSection& Section = IN_Chunk->SectionList[IN_SectionIndex];
+    if (Section.VoxelNum == 0) { return false; }
+
+    if (Section.BlockCountList.size() == 1 && Section.BlockCountList[0].Y == F_UINT_MAX) { return true; }
+    if (Section.OpaqueCount < Section.VoxelNum) { return false; }
+
+    // Outside of the Y bounds and chunks not loaded are Air - see "_Internal_GatherSection()"
+    if (IN_SectionIndex == 0 || IN_SectionIndex + 1 >= SectionsPerChunk) { return false; }
+    for (fInt S = -1; S <= 1; S += 2) {
+        const fVoxelSection& Next = IN_Chunk->SectionList[IN_SectionIndex + S];
+        if (Next.VoxelNum == 0 || Next.OpaqueCount < Next.VoxelNum) { return false; }
+    }
+    for (fUInt N = 0; N < F_VOXEL_NEIGHBOUR_NUM; N++) {
+        // Occupancy of a neighbour written directly is only rebuilt once it is meshed itself
+        if (IN_Chunk->NeighbourList[N] == nullptr || IN_Chunk->NeighbourList[N]->isOccupancyDirty) { return false; }
+
+        const fVoxelSection& Next = IN_Chunk->NeighbourList[N]->SectionList[IN_SectionIndex];
+        if (Next.VoxelNum == 0 || Next.OpaqueCount < Next.VoxelNum) { return false; }
+    }
+
+    return true;
+}
+fBool fVoxelWorld::UpdateChunkOccupancy(fUInt IN_ChunkIndex) {
+    if (!isInit) { return false; }
+    if (IN_ChunkIndex >= ChunksPerWorld || !ChunkList[IN_ChunkIndex]->isExist) { return false; }
+
+    _Internal_BuildOccupancy(ChunkList[IN_ChunkIndex]);
+    return true;
+}
+fBool fVoxelWorld::GetSectionBlockCount(fUInt IN_ChunkIndex, fUInt IN_SectionIndex, fUInt IN_BlockID, fUInt& OUT_Count) {
+    if (!isInit) { return false; }
+    if (IN_ChunkIndex >= ChunksPerWorld || !ChunkList[IN_ChunkIndex]->isExist) { return false; }
+    if (IN_SectionIndex >= SectionsPerChunk) { return false; }
+
+    _Internal_RefreshChunkData(ChunkList[IN_ChunkIndex]);
+
+    OUT_Count = 0;
+    const std::vector<fVector2ui>& List = ChunkList[IN_ChunkIndex]->SectionList[IN_SectionIndex].BlockCountList;
+    for (fUInt X = 0; X < List.size(); X++) {
+        if (List[X].Y == IN_BlockID) { OUT_Count = List[X].X; }
+    }
+    return true;
+}
+fBool fVoxelWorld::GetisSectionEmpty(fUInt IN_ChunkIndex, fUInt IN_SectionIndex) {
+    fUInt Count = 0;
+    if (!GetSectionBlockCount(IN_ChunkIndex, IN_SectionIndex, F_UINT_MAX, Count)) { return false; }
+
+    return Count == ChunkList[IN_ChunkIndex]->SectionList[IN_SectionIndex].VoxelNum;
+}
+fBool fVoxelWorld::GetisSectionFull(fUInt IN_ChunkIndex, fUInt IN_SectionIndex) {
+    if (!isInit) { return false; }
+    if (IN_ChunkIndex >= ChunksPerWorld || !ChunkList[IN_ChunkIndex]->isExist) { return false; }
+    if (IN_SectionIndex >= SectionsPerChunk) { return false; }
+
+    _Internal_RefreshChunkData(ChunkList[IN_ChunkIndex]);
+
+    const fVoxelSection& Section = ChunkList[IN_ChunkIndex]->SectionList[IN_SectionIndex];
+    return Section.SolidCount == Section.VoxelNum;
+}
+fBool fVoxelWorld::FindBlocks(fInt IN_X, fInt IN_Y, fInt IN_Z, fUInt IN_Radius, fUInt IN_BlockID, std::vector<fVoxelGlobalPos>& OUT_PosList) {
+    if (!isInit) { return false; }
+
+    fInt Radius = (fInt)IN_Radius;
+    fLong RadiusSq = (fLong)Radius * Radius;
+    fInt MinY = std::max(IN_Y - Radius, 0);
+    fInt MaxY = std::min(IN_Y + Radius, (fInt)ChunkSize_Y - 1);
+    if (MinY > MaxY) { return true; }
+
+    for (fInt CZ = ChunkDiv_Z.Div(IN_Z - Radius); CZ <= ChunkDiv_Z.Div(IN_Z + Radius); CZ++) {
+        fInt BaseZ = CZ * (fInt)ChunkSize_Z;
+        fInt StartZ = std::max(IN_Z - Radius - BaseZ, 0);
+        fInt EndZ = std::min(IN_Z + Radius - BaseZ, (fInt)ChunkSize_Z - 1);
+
+        for (fInt CX = ChunkDiv_X.Div(IN_X - Radius); CX <= ChunkDiv_X.Div(IN_X + Radius); CX++) {
+            fUInt CIndex = _Internal_GetChunkIndex(CX, CZ);
+            if (CIndex == F_UINT_MAX) { continue; }
+            fVoxelChunk* ChunkPtr = ChunkList[CIndex];
+
+            fInt BaseX = CX * (fInt)ChunkSize_X;
+            fInt StartX = std::max(IN_X - Radius - BaseX, 0);
+            fInt EndX = std::min(IN_X + Radius - BaseX, (fInt)ChunkSize_X - 1);
+
+            for (fInt S = MinY / F_VOXEL_SECTION_SIZE_Y; S <= MaxY / F_VOXEL_SECTION_SIZE_Y; S++) {
+                fUInt Count = 0;
+                GetSectionBlockCount(CIndex, S, IN_BlockID, Count);
+                if (Count == 0) { continue; }
+
+                fInt SectionMinY = std::max(MinY, S * F_VOXEL_SECTION_SIZE_Y);
+                fInt SectionMaxY = std::min(MaxY, ((S + 1) * F_VOXEL_SECTION_SIZE_Y) - 1);
+                for (fInt Y = SectionMinY; Y <= SectionMaxY; Y++) {
+                    for (fInt Z = StartZ; Z <= EndZ; Z++) {
+                        for (fInt X = StartX; X <= EndX; X++) {
+                            fLong DX = BaseX + X - IN_X;
+                            fLong DY = Y - IN_Y;
+                            fLong DZ = BaseZ + Z - IN_Z;
+                            if ((DX * DX) + (DY * DY) + (DZ * DZ) > RadiusSq) { continue; }
+                            if (ChunkPtr->GetBlock(ChunkPtr->GetVoxelIndex(X, Y, Z)) != IN_BlockID) { continue; }
+
+                            OUT_PosList.push_back({ BaseX + X, Y, BaseZ + Z });
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return true;
+}
+fBool fVoxelWorld::GetHeight(fInt IN_X, fInt IN_Z, fInt& OUT_Height, fBool IN_isSolid) {
+    if (!isInit) { return false; }
+
+    fUInt CIndex = _Internal_GetChunkIndex(ChunkDiv_X.Div(IN_X), ChunkDiv_Z.Div(IN_Z));
+    if (CIndex == F_UINT_MAX) { return false; }
+
+    _Internal_RefreshChunkData(ChunkList[CIndex]);
+
+    fUInt Column = (ChunkDiv_Z.Mod(IN_Z) * ChunkSize_X) + ChunkDiv_X.Mod(IN_X);
+    OUT_Height = IN_isSolid ? ChunkList[CIndex]->SolidHeightList[Column] : ChunkList[CIndex]->TopHeightList[Column];
+    return true;
+}
+fUChar fVoxelWorld::_Internal_GetLight(fVoxelChunk* IN_Chunk, fInt IN_X, fInt IN_Y, fInt IN_Z) {
+    if (IN_Y >= (fInt)ChunkSize_Y) { return 0xF0; }
+    if (IN_Y < 0) { return 0; }
+
+    fVoxelChunk* ChunkPtr = IN_Chunk;
+    if (IN_X < 0) {
+        ChunkPtr = ChunkPtr->NeighbourList[F_VOXEL_NEIGHBOUR_RIGHT];
+        IN_X += ChunkSize_X;
+    }
+    else if (IN_X >= (fInt)ChunkSize_X) {
+        ChunkPtr = ChunkPtr->NeighbourList[F_VOXEL_NEIGHBOUR_LEFT];
+        IN_X -= ChunkSize_X;
+    }
+    else if (IN_Z < 0) {
+        ChunkPtr = ChunkPtr->NeighbourList[F_VOXEL_NEIGHBOUR_FRONT];
+        IN_Z += ChunkSize_Z;
+    }
+    else if (IN_Z >= (fInt)ChunkSize_Z) {
+        ChunkPtr = ChunkPtr->NeighbourList[F_VOXEL_NEIGHBOUR_BACK];
+        IN_Z -= ChunkSize_Z;
+    }
+
+    // Diagonal corners are not read by the mesher
+    if (IN_Z < 0 || IN_Z >= (fInt)ChunkSize_Z) { return 0xF0; }
+    if (ChunkPtr == nullptr || !ChunkPtr->isLightReady) { return 0xF0; }
+
+    return _Internal_GetLightRef(ChunkPtr, IN_X, IN_Y, IN_Z);
+}
+fBool fVoxelWorld::_Internal_StepLightNode(fVoxelLightNode& REF_Node, fUInt IN_Dir) {
+    const fInt* Axis = fVoxel_FaceAxis[IN_Dir];
+    fInt Pos[3] = { (fInt)REF_Node.X, (fInt)REF_Node.Y, (fInt)REF_Node.Z };
+    Pos[Axis[0]] += Axis[1];
+
+    if (Pos[1] < 0 || Pos[1] >= (fInt)ChunkSize_Y) { return false; }
+
+    // Directions 0-3 are the same as F_VOXEL_NEIGHBOUR_*
+    if (Pos[0] < 0 || Pos[0] >= (fInt)ChunkSize_X || Pos[2] < 0 || Pos[2] >= (fInt)ChunkSize_Z) {
+        fVoxelChunk* NeighbourPtr = REF_Node.Chunk->NeighbourList[IN_Dir];
+        if (NeighbourPtr == nullptr || !NeighbourPtr->isLightReady) { return false; }
+
+        REF_Node.Chunk = NeighbourPtr;
+        Pos[0] = (Pos[0] + (fInt)ChunkSize_X) % (fInt)ChunkSize_X;
+        Pos[2] = (Pos[2] + (fInt)ChunkSize_Z) % (fInt)ChunkSize_Z;
+    }
+
+    REF_Node.X = Pos[0];
+    REF_Node.Y = Pos[1];
+    REF_Node.Z = Pos[2];
+    return true;
+}
+void fVoxelWorld::_Internal_InitChunkLight(fVoxelChunk* IN_Chunk) {
+    if (!IN_Chunk->isExist || IN_Chunk->isLightReady) { return; }
+
+    const fVoxelBlockRegistry& Reg = BlockRegistry;
+    fUInt SectionVolume = ChunkSize_X * F_VOXEL_SECTION_SIZE_Y * ChunkSize_Z;
+    for (fUInt X = 0; X < SectionsPerChunk; X++) { IN_Chunk->SectionList[X].LightList.assign(SectionVolume, 0); }
+    IN_Chunk->isLightReady = true;
+
+    // Sky light - Full down each column until the first opaque block
+    fInt MaxTop = -1;
+    for (fUInt Z = 0; Z < ChunkSize_Z; Z++) {
+        for (fUInt X = 0; X < ChunkSize_X; X++) {
+            // Nothing but Air above the top of the column
+            fInt Top = IN_Chunk->TopHeightList[(Z * ChunkSize_X) + X];
+            for (fInt Y = ChunkSize_Y - 1; Y > Top; Y--) { _Internal_GetLightRef(IN_Chunk, X, Y, Z) = 0xF0; }
+
+            for (fInt Y = Top; Y >= 0; Y--) {
+                if (Reg.GetisOpaque(IN_Chunk->GetBlock(IN_Chunk->GetVoxelIndex(X, Y, Z)))) {
+                    MaxTop = std::max(MaxTop, Y);
+                    break;
+                }
+                _Internal_GetLightRef(IN_Chunk, X, Y, Z) = 0xF0;
+            }
+        }
+    }
+
+    // Above the highest opaque block every voxel of the chunk is fully lit
+    // So only the voxels below it (and along the border, next to the neighbours) can spread sideways
+    for (fUInt Z = 0; Z < ChunkSize_Z; Z++) {
+        for (fUInt X = 0; X < ChunkSize_X; X++) {
+            fBool isBorder = X == 0 || Z == 0 || X == ChunkSize_X - 1 || Z == ChunkSize_Z - 1;
+            fInt MaxY = isBorder ? (fInt)ChunkSize_Y - 1 : MaxTop;
+            for (fInt Y = 0; Y <= MaxY; Y++) {
+                if (_Internal_GetLightRef(IN_Chunk, X, Y, Z) == 0) { continue; }
+                LightAddQueue.push_back({IN_Chunk, X, (fUInt)Y, Z, 0});
+            }
+        }
+    }
+    _Internal_QueueBorderLight(IN_Chunk, 4);
+    _Internal_SpreadLight(4);
+
+    // Block light - From the emitters
+    for (fUInt Y = 0; Y < ChunkSize_Y; Y++) {
+        for (fUInt Z = 0; Z < ChunkSize_Z; Z++) {
+            for (fUInt X = 0; X < ChunkSize_X; X++) {
+                fUInt Light = Reg.GetLight(IN_Chunk->GetBlock(IN_Chunk->GetVoxelIndex(X, Y, Z)));
+                if (Light == 0) { continue; }
+
+                _Internal_GetLightRef(IN_Chunk, X, Y, Z) |= Light;
+                LightAddQueue.push_back({IN_Chunk, X, Y, Z, 0});
+            }
+        }
+    }
+    _Internal_QueueBorderLight(IN_Chunk, 0);
+    _Internal_SpreadLight(0);
+
+    // Faces of the neighbours looking at this chunk were meshed without its light
+    _Internal_MarkNeighboursDirty(IN_Chunk);
+}
+void fVoxelWorld::_Internal_QueueBorderLight(fVoxelChunk* IN_Chunk, fUInt IN_Shift) {
+    for (fUInt N = 0; N < F_VOXEL_NEIGHBOUR_NUM; N++) {
+        fVoxelChunk* NeighbourPtr = IN_Chunk->NeighbourList[N];
+        if (NeighbourPtr == nullptr || !NeighbourPtr->isLightReady) { continue; }
+
+        // Row of the neighbour touching this chunk
+        fUInt Num = N < 2 ? ChunkSize_X : ChunkSize_Z;
+        for (fUInt Y = 0; Y < ChunkSize_Y; Y++) {
+            for (fUInt I = 0; I < Num; I++) {
+                fUInt X = N < 2 ? I : (N == F_VOXEL_NEIGHBOUR_LEFT ? 0 : ChunkSize_X - 1);
+                fUInt Z = N >= 2 ? I : (N == F_VOXEL_NEIGHBOUR_BACK ? 0 : ChunkSize_Z - 1);
+                if (((_Internal_GetLightRef(NeighbourPtr, X, Y, Z) >> IN_Shift) & 0xF) == 0) { continue; }
+
+                LightAddQueue.push_back({NeighbourPtr, X, Y, Z, 0});
+            }
+        }
+    }
+}
+void fVoxelWorld::_Internal_RelightBox(fVoxelChunk* IN_Chunk, fInt IN_MinX, fInt IN_MinY, fInt IN_MinZ, fInt IN_MaxX, fInt IN_MaxY, fInt IN_MaxZ) {
+    const fVoxelBlockRegistry& Reg = BlockRegistry;
+
+    for (fUInt Shift = 0; Shift <= 4; Shift += 4) {
+        fUChar Mask = 0xF << Shift;
+
+        // Every voxel of the box is darkened first - Unchanged voxels simply get their light back
+        for (fInt Y = IN_MinY; Y <= IN_MaxY; Y++) {
+            for (fInt Z = IN_MinZ; Z <= IN_MaxZ; Z++) {
+                for (fInt X = IN_MinX; X <= IN_MaxX; X++) {
+                    fUChar& Light = _Internal_GetLightRef(IN_Chunk, X, Y, Z);
+                    LightRemoveQueue.push_back({IN_Chunk, (fUInt)X, (fUInt)Y, (fUInt)Z, (fUInt)((Light & Mask) >> Shift)});
+                    Light &= ~Mask;
+                    _Internal_MarkLightDirty(IN_Chunk, X, Y, Z);
+                }
+            }
+        }
+        _Internal_RemoveLight(Shift);
+
+        // Light sources within the box - Sky at the top of the world, emitters for block light
+        for (fInt Y = IN_MinY; Y <= IN_MaxY; Y++) {
+            for (fInt Z = IN_MinZ; Z <= IN_MaxZ; Z++) {
+                for (fInt X = IN_MinX; X <= IN_MaxX; X++) {
+                    fUInt ID = IN_Chunk->GetBlock(IN_Chunk->GetVoxelIndex(X, Y, Z));
+                    fUInt Light = Shift == 0 ? Reg.GetLight(ID) : 0;
+                    if (Shift == 4 && Y == (fInt)ChunkSize_Y - 1 && !Reg.GetisOpaque(ID)) { Light = 15; }
+                    if (Light == 0) { continue; }
+
+                    _Internal_GetLightRef(IN_Chunk, X, Y, Z) |= Light << Shift;
+                    LightAddQueue.push_back({IN_Chunk, (fUInt)X, (fUInt)Y, (fUInt)Z, 0});
+                }
+            }
+        }
+        _Internal_SpreadLight(Shift);
+    }
+}
+void fVoxelWorld::_Internal_RemoveLight(fUInt IN_Shift) {
+    fUChar Mask = 0xF << IN_Shift;
+    fBool isSky = IN_Shift == 4;
+
+    // Grows while being processed
+    for (size_t Q = 0; Q < LightRemoveQueue.size(); Q++) {
+        fVoxelLightNode Node = LightRemoveQueue[Q];
+
+        for (fUInt D = 0; D < 6; D++) {
+            fVoxelLightNode Next = Node;
+            if (!_Internal_StepLightNode(Next, D)) { continue; }
+
+            fUChar& Light = _Internal_GetLightRef(Next.Chunk, Next.X, Next.Y, Next.Z);
+            fUInt Level = (Light & Mask) >> IN_Shift;
+            if (Level == 0) { continue; }
+
+            // Lit by the removed light - Full sky light going down (5 - Y-) is not reduced
+            if (Level < Node.Level || (isSky && D == 5 && Node.Level == 15)) {
+                Light &= ~Mask;
+                _Internal_MarkLightDirty(Next.Chunk, Next.X, Next.Y, Next.Z);
+
+                Next.Level = Level;
+                LightRemoveQueue.push_back(Next);
+                continue;
+            }
+
+            // Lit by another source - Spreads back into the darkened voxels
+            LightAddQueue.push_back(Next);
+        }
+    }
+
+    LightRemoveQueue.clear();
+}
+void fVoxelWorld::_Internal_SpreadLight(fUInt IN_Shift) {
+    const fVoxelBlockRegistry& Reg = BlockRegistry;
+    fUChar Mask = 0xF << IN_Shift;
+    fBool isSky = IN_Shift == 4;
+
+    // Grows while being processed
+    for (size_t Q = 0; Q < LightAddQueue.size(); Q++) {
+        fVoxelLightNode Node = LightAddQueue[Q];
+        fUInt Level = (_Internal_GetLightRef(Node.Chunk, Node.X, Node.Y, Node.Z) & Mask) >> IN_Shift;
+        if (Level <= 1) { continue; }
+
+        for (fUInt D = 0; D < 6; D++) {
+            fVoxelLightNode Next = Node;
+            if (!_Internal_StepLightNode(Next, D)) { continue; }
+            if (Reg.GetisOpaque(Next.Chunk->GetBlock(Next.Chunk->GetVoxelIndex(Next.X, Next.Y, Next.Z)))) { continue; }
+
+            fUInt NextLevel = (isSky && D == 5 && Level == 15) ? 15 : Level - 1;
+            fUChar& Light = _Internal_GetLightRef(Next.Chunk, Next.X, Next.Y, Next.Z);
+            if ((fUInt)((Light & Mask) >> IN_Shift) >= NextLevel) { continue; }
+
+            Light = (Light & ~Mask) | (NextLevel << IN_Shift);
+            _Internal_MarkLightDirty(Next.Chunk, Next.X, Next.Y, Next.Z);
+            LightAddQueue.push_back(Next);
+        }
+    }
+
+    LightAddQueue.clear();
+}
+void fVoxelWorld::_Internal_MarkLightDirty(fVoxelChunk* IN_Chunk, fUInt IN_X, fUInt IN_Y, fUInt IN_Z) {
+    // Faces of the voxels around it sample its light
+    IN_Chunk->isMeshDirty = true;
+    fUInt MinSection = IN_Y > 0 ? (IN_Y - 1) / F_VOXEL_SECTION_SIZE_Y : 0;
+    fUInt MaxSection = std::min((IN_Y + 1) / F_VOXEL_SECTION_SIZE_Y, SectionsPerChunk - 1);
+    for (fUInt X = MinSection; X <= MaxSection; X++) { IN_Chunk->SectionList[X].isMeshDirty = true; }
+
+    fBool isBorder[F_VOXEL_NEIGHBOUR_NUM] = {
+        IN_Z == 0,
+        IN_Z == ChunkSize_Z - 1,
+        IN_X == ChunkSize_X - 1,
+        IN_X == 0
+    };
+    for (fUInt N = 0; N < F_VOXEL_NEIGHBOUR_NUM; N++) {
+        fVoxelChunk* NeighbourPtr = IN_Chunk->NeighbourList[N];
+        if (!isBorder[N] || NeighbourPtr == nullptr) { continue; }
+
+        NeighbourPtr->isMeshDirty = true;
+        NeighbourPtr->SectionList[IN_Y / F_VOXEL_SECTION_SIZE_Y].isMeshDirty = true;
+    }
+}
+void fVoxelWorld::_Internal_ResetLight() {
+    for (fUInt X = 0; X < ChunksPerWorld; X++) {
+        ChunkList[X]->isLightReady = false;
+        for (fUInt Y = 0; Y < ChunkList[X]->SectionList.size(); Y++) { std::vector<fUChar>().swap(ChunkList[X]->SectionList[Y].LightList); }
+    }
+}
+void fVoxelWorld::_Internal_GatherSectionLight(fUInt IN_ChunkIndex, fUInt IN_SectionIndex) {
+    fVoxelChunk* ChunkPtr = ChunkList[IN_ChunkIndex];
+    LightScratch.resize(MeshPad_X * (F_VOXEL_SECTION_SIZE_Y + 2) * MeshPad_Z);
+
+    fInt MinY = (fInt)(IN_SectionIndex * F_VOXEL_SECTION_SIZE_Y) - 1;
+    fUInt Index = 0;
+    for (fUInt PY = 0; PY < F_VOXEL_SECTION_SIZE_Y + 2; PY++) {
+        for (fUInt PZ = 0; PZ < MeshPad_Z; PZ++) {
+            for (fUInt PX = 0; PX < MeshPad_X; PX++) {
+                LightScratch[Index++] = _Internal_GetLight(ChunkPtr, (fInt)PX - 1, MinY + (fInt)PY, (fInt)PZ - 1);
+            }
+        }
+    }
+}
+fBool fVoxelWorld::GetLight(fInt IN_X, fInt IN_Y, fInt IN_Z, fUInt& OUT_SkyLight, fUInt& OUT_BlockLight) {
+    if (!isInit) { return false; }
+    if (IN_Y < 0 || IN_Y >= (fInt)ChunkSize_Y) { return false; }
+
+    fUInt CIndex = _Internal_GetChunkIndex(ChunkDiv_X.Div(IN_X), ChunkDiv_Z.Div(IN_Z));
+    if (CIndex == F_UINT_MAX || !ChunkList[CIndex]->isLightReady) { return false; }
+
+    fUChar Light = _Internal_GetLightRef(ChunkList[CIndex], ChunkDiv_X.Mod(IN_X), IN_Y, ChunkDiv_Z.Mod(IN_Z));
+    OUT_SkyLight = Light >> 4;
+    OUT_BlockLight = Light & 0xF;
+    return true;
+}
+fVoxelRayHit fVoxelWorld::Raycast(fVector3 IN_Origin, fVector3 IN_Direction, fFloat IN_MaxDistance) {
+    fVoxelRayHit Result;
+    if (!isInit) { return Result; }
+
+    fFloat Length = std::sqrt((IN_Direction.X * IN_Direction.X) + (IN_Direction.Y * IN_Direction.Y) + (IN_Direction.Z * IN_Direction.Z));
+    if (Length <= 0.0F) { return Result; }
+
+    // Voxel space - Distances stay in world units along the normalised direction
+    fFloat Origin[3] = { IN_Origin.X / VoxelSize_X, IN_Origin.Y / VoxelSize_Y, IN_Origin.Z / VoxelSize_Z };
+    fFloat Dir[3] = { IN_Direction.X / (Length * VoxelSize_X), IN_Direction.Y / (Length * VoxelSize_Y), IN_Direction.Z / (Length * VoxelSize_Z) };
+
+    fInt Pos[3];
+    fInt Step[3];
+    fFloat TMax[3];     // Distance to the next voxel boundary on each axis
+    fFloat TDelta[3];   // Distance between 2 voxel boundaries on each axis
+    for (fUInt A = 0; A < 3; A++) {
+        Pos[A] = (fInt)std::floor(Origin[A]);
+        Step[A] = Dir[A] > 0.0F ? 1 : (Dir[A] < 0.0F ? -1 : 0);
+        TDelta[A] = Step[A] != 0 ? std::fabs(1.0F / Dir[A]) : INFINITY;
+
+        if (Step[A] > 0) { TMax[A] = ((fFloat)(Pos[A] + 1) - Origin[A]) / Dir[A]; }
+        else if (Step[A] < 0) { TMax[A] = (Origin[A] - (fFloat)Pos[A]) / -Dir[A]; }
+        else { TMax[A] = INFINITY; }
+    }
+
+    // Face entered when stepping along X, Y, Z - positive step, negative step
+    static const fUInt EnterFace[3][2] = { {3, 2}, {5, 4}, {0, 1} };
+
+    fVoxelChunk* ChunkPtr = _Internal_FindChunk(ChunkDiv_X.Div(Pos[0]), ChunkDiv_Z.Div(Pos[2]));
+    fInt LocalX = ChunkDiv_X.Mod(Pos[0]);
+    fInt LocalZ = ChunkDiv_Z.Mod(Pos[2]);
+    fUInt Face = F_UINT_MAX;
+    fFloat Distance = 0.0F;
+
+    while (ChunkPtr != nullptr) {
+        if (Pos[1] >= 0 && Pos[1] < (fInt)ChunkSize_Y) {
+            fUInt ID = ChunkPtr->GetBlock(ChunkPtr->GetVoxelIndex(LocalX, Pos[1], LocalZ));
+            if (ID != F_UINT_MAX) {
+                Result.isHit = true;
+                Result.Voxel = { Pos[0], Pos[1], Pos[2] };
+                Result.BlockID = ID;
+                Result.Face = Face;
+                Result.Distance = Distance;
+                return Result;
+            }
+        }
+        // Outside of the Y bounds and moving away
+        else if ((Pos[1] < 0 && Step[1] <= 0) || (Pos[1] >= (fInt)ChunkSize_Y && Step[1] >= 0)) { break; }
+
+        // Next voxel along the axis with the closest boundary
+        fUInt A = TMax[0] < TMax[1] ? (TMax[0] < TMax[2] ? 0 : 2) : (TMax[1] < TMax[2] ? 1 : 2);
+        Distance = TMax[A];
+        if (Distance > IN_MaxDistance) { break; }
+
+        TMax[A] += TDelta[A];
+        Pos[A] += Step[A];
+        Face = EnterFace[A][Step[A] > 0 ? 0 : 1];
+
+        // Chunk borders - Through the neighbour links instead of a chunk lookup
+        if (A == 0) {
+            LocalX += Step[0];
+            if (LocalX < 0) {
+                ChunkPtr = ChunkPtr->NeighbourList[F_VOXEL_NEIGHBOUR_RIGHT];
+                LocalX = ChunkSize_X - 1;
+            }
+            else if (LocalX >= (fInt)ChunkSize_X) {
+                ChunkPtr = ChunkPtr->NeighbourList[F_VOXEL_NEIGHBOUR_LEFT];
+                LocalX = 0;
+            }
+        }
+        else if (A == 2) {
+            LocalZ += Step[2];
+            if (LocalZ < 0) {
+                ChunkPtr = ChunkPtr->NeighbourList[F_VOXEL_NEIGHBOUR_FRONT];
+                LocalZ = ChunkSize_Z - 1;
+            }
+            else if (LocalZ >= (fInt)ChunkSize_Z) {
+                ChunkPtr = ChunkPtr->NeighbourList[F_VOXEL_NEIGHBOUR_BACK];
+                LocalZ = 0;
+            }
+        }
+    }
 
-                fUInt Index = ChunkList[IN_ChunkIndex].GetVoxelIndex(X,Y,Z);
-                if (ChunkList[IN_ChunkIndex].BlockList[Index] < F_UINT_MAX) {
-                    if (_Internal_GenerateVoxel(IN_ChunkIndex, Index, LPos, OUT_Mesh)) {
-                        ChunkList[IN_ChunkIndex].VisibleVoxels++;
+    return Result;
+}
+void fVoxelWorld::RaycastBatch(const fVoxelRay* IN_RayList, fVoxelRayHit* OUT_HitList, size_t IN_Num, fUInt IN_ThreadNum) {
+    _Internal_RunBatch(IN_Num, IN_ThreadNum, F_VOXEL_RAYCAST_MIN_PER_THREAD, [&](size_t IN_Start, size_t IN_End) {
+        _Internal_RaycastRange(IN_RayList, OUT_HitList, IN_Start, IN_End);
+    });
+}
+void fVoxelWorld::_Internal_RunBatch(size_t IN_Num, fUInt IN_ThreadNum, size_t IN_MinPerThread, const std::function<void(size_t, size_t)>& IN_Func) {
+    if (IN_Num == 0) { return; }
+    if (IN_ThreadNum == 0) { IN_ThreadNum = std::max(1U, std::thread::hardware_concurrency()); }
+
+    size_t PerThread = std::max(std::max((size_t)1, IN_MinPerThread), (IN_Num + IN_ThreadNum - 1) / IN_ThreadNum);
+
+    std::vector<std::thread> ThreadList;
+    for (size_t Start = PerThread; Start < IN_Num; Start += PerThread) {
+        ThreadList.emplace_back(IN_Func, Start, std::min(IN_Num, Start + PerThread));
+    }
+    IN_Func(0, std::min(IN_Num, PerThread));
+
+    for (fUInt X = 0; X < ThreadList.size(); X++) { ThreadList[X].join(); }
+}
+void fVoxelWorld::_Internal_RaycastRange(const fVoxelRay* IN_RayList, fVoxelRayHit* OUT_HitList, size_t IN_Start, size_t IN_End) {
+    for (size_t X = IN_Start; X < IN_End; X++) {
+        OUT_HitList[X] = Raycast(IN_RayList[X].Origin, IN_RayList[X].Direction, IN_RayList[X].MaxDistance);
+    }
+}
+fBool fVoxelWorld::_Internal_GetisRangeSolid(fInt IN_MinX, fInt IN_MinY, fInt IN_MinZ, fInt IN_MaxX, fInt IN_MaxY, fInt IN_MaxZ) {
+    IN_MinY = std::max(IN_MinY, 0);
+    IN_MaxY = std::min(IN_MaxY, (fInt)ChunkSize_Y - 1);
+    if (IN_MinY > IN_MaxY) { return false; }
+
+    // One lookup per chunk, then chunk-local indices
+    for (fInt CZ = ChunkDiv_Z.Div(IN_MinZ); CZ <= ChunkDiv_Z.Div(IN_MaxZ); CZ++) {
+        fInt BaseZ = CZ * (fInt)ChunkSize_Z;
+        fInt StartZ = std::max(IN_MinZ - BaseZ, 0);
+        fInt EndZ = std::min(IN_MaxZ - BaseZ, (fInt)ChunkSize_Z - 1);
+
+        for (fInt CX = ChunkDiv_X.Div(IN_MinX); CX <= ChunkDiv_X.Div(IN_MaxX); CX++) {
+            fVoxelChunk* ChunkPtr = _Internal_FindChunk(CX, CZ);
+            if (ChunkPtr == nullptr) { return true; }
+
+            // Uniform chunk - Every voxel is the same
+            if (!ChunkPtr->isAllocated) {
+                if (BlockRegistry.GetisSolid(ChunkPtr->UniformBlock)) { return true; }
+                continue;
+            }
+
+            fInt BaseX = CX * (fInt)ChunkSize_X;
+            fInt StartX = std::max(IN_MinX - BaseX, 0);
+            fInt EndX = std::min(IN_MaxX - BaseX, (fInt)ChunkSize_X - 1);
+
+            // Occupancy of a chunk written directly is out of date - Batches may run here on several threads, so it is not rebuilt
+            if (ChunkPtr->isOccupancyDirty) {
+                for (fInt Y = IN_MinY; Y <= IN_MaxY; Y++) {
+                    for (fInt Z = StartZ; Z <= EndZ; Z++) {
+                        for (fInt X = StartX; X <= EndX; X++) {
+                            if (BlockRegistry.GetisSolid(ChunkPtr->BlockList[ChunkPtr->GetVoxelIndex(X, Y, Z)])) { return true; }
+                        }
                     }
                 }
+                continue;
             }
+
+            for (fInt Y = IN_MinY; Y <= IN_MaxY; Y++) {
+                // Sections without / only solid voxels answer without their bits
+                const fVoxelSection& Section = ChunkPtr->SectionList[Y / F_VOXEL_SECTION_SIZE_Y];
+                if (Section.SolidCount == 0) {
+                    Y = ((Y / F_VOXEL_SECTION_SIZE_Y) + 1) * F_VOXEL_SECTION_SIZE_Y - 1;
+                    continue;
+                }
+                if (Section.SolidCount == Section.VoxelNum) { return true; }
+
+                for (fInt Z = StartZ; Z <= EndZ; Z++) {
+                    fUInt Bit = _Internal_GetSectionBit(StartX, Y, Z);
+                    for (fInt X = StartX; X <= EndX; X++, Bit++) {
+                        if (Section.SolidBits[Bit >> 5] & (1u << (Bit & 31))) { return true; }
+                    }
+                }
+            }
+        }
+    }
+
+    return false;
+}
+fFloat fVoxelWorld::_Internal_SweepAxis(fUInt IN_Axis, fFloat* REF_Min, fFloat* REF_Max, fFloat IN_Delta) {
+    if (IN_Delta == 0.0F) { return 0.0F; }
+
+    const fFloat Size[3] = { VoxelSize_X, VoxelSize_Y, VoxelSize_Z };
+
+    // Voxel range covered by the box - The skin keeps touching faces from counting as overlap
+    fInt Min[3];
+    fInt Max[3];
+    for (fUInt A = 0; A < 3; A++) {
+        fFloat Skin = F_VOXEL_SWEEP_EPSILON * Size[A];
+        Min[A] = (fInt)std::floor((REF_Min[A] + Skin) / Size[A]);
+        Max[A] = (fInt)std::floor((REF_Max[A] - Skin) / Size[A]);
+    }
+
+    // Layers of voxels in front of the box, nearest first
+    fFloat Skin = F_VOXEL_SWEEP_EPSILON * Size[IN_Axis];
+    fInt Step = IN_Delta > 0.0F ? 1 : -1;
+    fInt First = IN_Delta > 0.0F ? Max[IN_Axis] + 1 : Min[IN_Axis] - 1;
+    fInt Last = IN_Delta > 0.0F ? (fInt)std::floor((REF_Max[IN_Axis] + IN_Delta - Skin) / Size[IN_Axis]) : (fInt)std::floor((REF_Min[IN_Axis] + IN_Delta + Skin) / Size[IN_Axis]);
+
+    fFloat Moved = IN_Delta;
+    for (fInt L = First; (L - Last) * Step <= 0; L += Step) {
+        Min[IN_Axis] = L;
+        Max[IN_Axis] = L;
+        if (!_Internal_GetisRangeSolid(Min[0], Min[1], Min[2], Max[0], Max[1], Max[2])) { continue; }
+
+        // Stop against the near face of the layer
+        Moved = Step > 0 ? ((fFloat)L * Size[IN_Axis]) - REF_Max[IN_Axis] : ((fFloat)(L + 1) * Size[IN_Axis]) - REF_Min[IN_Axis];
+        break;
+    }
+
+    REF_Min[IN_Axis] += Moved;
+    REF_Max[IN_Axis] += Moved;
+    return Moved;
+}
+fVoxelSweepResult fVoxelWorld::SweepAABB(const fVoxelAABB& IN_Box, fVector3 IN_Delta) {
+    fVoxelSweepResult Result;
+    Result.Box = IN_Box;
+    if (!isInit) { return Result; }
+
+    fFloat Min[3] = { IN_Box.Min.X, IN_Box.Min.Y, IN_Box.Min.Z };
+    fFloat Max[3] = { IN_Box.Max.X, IN_Box.Max.Y, IN_Box.Max.Z };
+    const fFloat Delta[3] = { IN_Delta.X, IN_Delta.Y, IN_Delta.Z };
+    fFloat Moved[3] = { 0.0F, 0.0F, 0.0F };
+    fInt Normal[3] = { 0, 0, 0 };
+
+    // Y first so walking on the ground does not catch on the voxel below
+    static const fUInt Order[3] = { 1, 0, 2 };
+    for (fUInt X = 0; X < 3; X++) {
+        fUInt A = Order[X];
+        Moved[A] = _Internal_SweepAxis(A, Min, Max, Delta[A]);
+        if (Moved[A] != Delta[A]) {
+            Normal[A] = Delta[A] > 0.0F ? -1 : 1;
+            Result.isCollided = true;
         }
     }
 
+    Result.Box.Min = { Min[0], Min[1], Min[2] };
+    Result.Box.Max = { Max[0], Max[1], Max[2] };
+    Result.Delta = { Moved[0], Moved[1], Moved[2] };
+    Result.Normal = { Normal[0], Normal[1], Normal[2] };
+    return Result;
+}
+void fVoxelWorld::SweepAABBBatch(const fVoxelAABB* IN_BoxList, const fVector3* IN_DeltaList, fVoxelSweepResult* OUT_ResultList, size_t IN_Num, fUInt IN_ThreadNum) {
+    _Internal_RunBatch(IN_Num, IN_ThreadNum, F_VOXEL_SWEEP_MIN_PER_THREAD, [&](size_t IN_Start, size_t IN_End) {
+        for (size_t X = IN_Start; X < IN_End; X++) { OUT_ResultList[X] = SweepAABB(IN_BoxList[X], IN_DeltaList[X]); }
+    });
+}
+fBool fVoxelWorld::SetVoxel(fInt IN_X, fInt IN_Y, fInt IN_Z, fVoxelBlock& REF_Voxel) {
+    return SetVoxel(IN_X, IN_Y, IN_Z, REF_Voxel.UID);
+}
+fBool fVoxelWorld::SetVoxel(fInt IN_X, fInt IN_Y, fInt IN_Z, fUInt IN_BlockID) {
+    if (!isInit) { return false; }
+    if (IN_Y < 0 || IN_Y >= (fInt)ChunkSize_Y) { return false; }
+
+    fUInt CIndex = _Internal_GetChunkIndex(ChunkDiv_X.Div(IN_X), ChunkDiv_Z.Div(IN_Z));
+    if (CIndex == F_UINT_MAX) { return false; }
+
+    return _Internal_SetChunkVoxel(CIndex, ChunkDiv_X.Mod(IN_X), IN_Y, ChunkDiv_Z.Mod(IN_Z), IN_BlockID);
+}
+fBool fVoxelWorld::GetVoxel(fInt IN_X, fInt IN_Y, fInt IN_Z, fVoxelBlock& OUT_Voxel) {
+    fUInt ID = GetVoxelIndex(IN_X, IN_Y, IN_Z);
+    if (ID >= VoxelList.size()) { return false; }
+
+    OUT_Voxel = VoxelList[ID];
     return true;
 }
-fBool fVoxelWorld::SetVoxel(fInt IN_X, fInt IN_Y, fInt IN_Z, fVoxelBlock& REF_Voxel) { return false; }
-fBool fVoxelWorld::GetVoxel(fInt IN_X, fInt IN_Y, fInt IN_Z, fVoxelBlock& OUT_Voxel) { return false; }
-fBool fVoxelWorld::ClearVoxel(fInt IN_X, fInt IN_Y, fInt IN_Z) { return false; }
+fBool fVoxelWorld::ClearVoxel(fInt IN_X, fInt IN_Y, fInt IN_Z) {
+    return SetVoxel(IN_X, IN_Y, IN_Z, F_UINT_MAX);
+}
+fBool fVoxelWorld::FillBox(fInt IN_MinX, fInt IN_MinY, fInt IN_MinZ, fInt IN_MaxX, fInt IN_MaxY, fInt IN_MaxZ, fUInt IN_BlockID) {
+    return _Internal_EditBox(IN_MinX, IN_MinY, IN_MinZ, IN_MaxX, IN_MaxY, IN_MaxZ, IN_BlockID, F_VOXEL_EDIT_ANY, -1);
+}
+fBool fVoxelWorld::FillSphere(fInt IN_CenterX, fInt IN_CenterY, fInt IN_CenterZ, fInt IN_Radius, fUInt IN_BlockID) {
+    if (IN_Radius < 0) { return false; }
+    return _Internal_EditBox(
+        IN_CenterX - IN_Radius, IN_CenterY - IN_Radius, IN_CenterZ - IN_Radius,
+        IN_CenterX + IN_Radius, IN_CenterY + IN_Radius, IN_CenterZ + IN_Radius,
+        IN_BlockID, F_VOXEL_EDIT_ANY, IN_Radius
+    );
+}
+fBool fVoxelWorld::FillColumn(fInt IN_X, fInt IN_Z, fInt IN_MinY, fInt IN_MaxY, fUInt IN_BlockID) {
+    return _Internal_EditBox(IN_X, IN_MinY, IN_Z, IN_X, IN_MaxY, IN_Z, IN_BlockID, F_VOXEL_EDIT_ANY, -1);
+}
+fBool fVoxelWorld::FillLayer(fInt IN_Y, fInt IN_MinX, fInt IN_MinZ, fInt IN_MaxX, fInt IN_MaxZ, fUInt IN_BlockID) {
+    return _Internal_EditBox(IN_MinX, IN_Y, IN_MinZ, IN_MaxX, IN_Y, IN_MaxZ, IN_BlockID, F_VOXEL_EDIT_ANY, -1);
+}
+fBool fVoxelWorld::ReplaceInBox(fInt IN_MinX, fInt IN_MinY, fInt IN_MinZ, fInt IN_MaxX, fInt IN_MaxY, fInt IN_MaxZ, fUInt IN_FromID, fUInt IN_ToID) {
+    if (IN_FromID == F_VOXEL_EDIT_ANY) { return false; }
+    return _Internal_EditBox(IN_MinX, IN_MinY, IN_MinZ, IN_MaxX, IN_MaxY, IN_MaxZ, IN_ToID, IN_FromID, -1);
+}
+fBool fVoxelWorld::ApplyEdits(const fVoxelEdit* IN_EditList, size_t IN_Num) {
+    if (!isInit) { return false; }
+    if (IN_Num == 0) { return true; }
+
+    // Group the edits by chunk - stable so edits of the same voxel keep their order
+    std::vector<fLong> KeyList(IN_Num);
+    std::vector<size_t> OrderList(IN_Num);
+    for (size_t X = 0; X < IN_Num; X++) {
+        KeyList[X] = _Internal_GetChunkKey(ChunkDiv_X.Div(IN_EditList[X].X), ChunkDiv_Z.Div(IN_EditList[X].Z));
+        OrderList[X] = X;
+    }
+    std::stable_sort(OrderList.begin(), OrderList.end(), [&](size_t A, size_t B) { return KeyList[A] < KeyList[B]; });
+
+    fBool Result = true;
+    size_t Start = 0;
+    while (Start < IN_Num) {
+        size_t End = Start + 1;
+        while (End < IN_Num && KeyList[OrderList[End]] == KeyList[OrderList[Start]]) { End++; }
+
+        const fVoxelEdit& First = IN_EditList[OrderList[Start]];
+        fUInt CIndex = _Internal_GetChunkIndex(ChunkDiv_X.Div(First.X), ChunkDiv_Z.Div(First.Z));
+        if (CIndex == F_UINT_MAX) { Start = End; continue; }
+
+        fVoxelChunk* ChunkPtr = ChunkList[CIndex];
+        fInt Min[3] = { F_INT_MAX, F_INT_MAX, F_INT_MAX };
+        fInt Max[3] = { -1, -1, -1 };
+
+        for (size_t X = Start; X < End; X++) {
+            const fVoxelEdit& Edit = IN_EditList[OrderList[X]];
+            if (Edit.Y < 0 || Edit.Y >= (fInt)ChunkSize_Y) { continue; }
+
+            fInt LX = ChunkDiv_X.Mod(Edit.X);
+            fInt LZ = ChunkDiv_Z.Mod(Edit.Z);
+            fUInt Index = ChunkPtr->GetVoxelIndex(LX, Edit.Y, LZ);
+            fUInt OldID = ChunkPtr->GetBlock(Index);
+            if (OldID == Edit.BlockID) { continue; }
+            if (!ChunkPtr->_Internal_SetBlock(Index, Edit.BlockID)) { Result = false; break; }
+            _Internal_CountVoxel(ChunkPtr, LX, Edit.Y, LZ, OldID, Edit.BlockID);
+
+            Min[0] = std::min(Min[0], LX); Max[0] = std::max(Max[0], LX);
+            Min[1] = std::min(Min[1], Edit.Y); Max[1] = std::max(Max[1], Edit.Y);
+            Min[2] = std::min(Min[2], LZ); Max[2] = std::max(Max[2], LZ);
+        }
+
+        if (Max[0] >= 0) { _Internal_MarkDirty(CIndex, Min[0], Min[1], Min[2], Max[0], Max[1], Max[2]); }
+        Start = End;
+    }
+
+    return Result;
+}
+fBool fVoxelWorld::_Internal_EditBox(fInt IN_MinX, fInt IN_MinY, fInt IN_MinZ, fInt IN_MaxX, fInt IN_MaxY, fInt IN_MaxZ, fUInt IN_BlockID, fUInt IN_ReplaceID, fInt IN_SphereRadius) {
+    if (!isInit) { return false; }
+
+    // Center of the sphere (box is always built around it)
+    fLong CenterX = ((fLong)IN_MinX + IN_MaxX) / 2;
+    fLong CenterY = ((fLong)IN_MinY + IN_MaxY) / 2;
+    fLong CenterZ = ((fLong)IN_MinZ + IN_MaxZ) / 2;
+    fLong RadiusSq = (fLong)IN_SphereRadius * IN_SphereRadius;
+
+    // Chunks only span Y [0, ChunkSize_Y)
+    fInt MinY = std::max(IN_MinY, 0);
+    fInt MaxY = std::min(IN_MaxY, (fInt)ChunkSize_Y - 1);
+    if (MinY > MaxY || IN_MinX > IN_MaxX || IN_MinZ > IN_MaxZ) { return true; }
+
+    fBool Result = true;
+    fInt ChunkMinX = ChunkDiv_X.Div(IN_MinX);
+    fInt ChunkMaxX = ChunkDiv_X.Div(IN_MaxX);
+    fInt ChunkMinZ = ChunkDiv_Z.Div(IN_MinZ);
+    fInt ChunkMaxZ = ChunkDiv_Z.Div(IN_MaxZ);
+
+    for (fInt CZ = ChunkMinZ; CZ <= ChunkMaxZ; CZ++) {
+        for (fInt CX = ChunkMinX; CX <= ChunkMaxX; CX++) {
+            fUInt CIndex = _Internal_GetChunkIndex(CX, CZ);
+            if (CIndex == F_UINT_MAX) { continue; }
+            fVoxelChunk* ChunkPtr = ChunkList[CIndex];
+
+            // Nothing to replace / write in an unallocated chunk holding a different / the same block
+            if (!ChunkPtr->isAllocated) {
+                if (IN_ReplaceID != F_VOXEL_EDIT_ANY && ChunkPtr->UniformBlock != IN_ReplaceID) { continue; }
+                if (ChunkPtr->UniformBlock == IN_BlockID) { continue; }
+            }
+
+            // Local box of this chunk
+            fLong OriginX = (fLong)CX * ChunkSize_X;
+            fLong OriginZ = (fLong)CZ * ChunkSize_Z;
+            fInt LMinX = (fInt)std::max<fLong>(IN_MinX - OriginX, 0);
+            fInt LMaxX = (fInt)std::min<fLong>(IN_MaxX - OriginX, ChunkSize_X - 1);
+            fInt LMinZ = (fInt)std::max<fLong>(IN_MinZ - OriginZ, 0);
+            fInt LMaxZ = (fInt)std::min<fLong>(IN_MaxZ - OriginZ, ChunkSize_Z - 1);
+
+            // Whole chunk is overwritten - drop the BlockList and make the chunk uniform
+            fBool isFullChunk = LMinX == 0 && LMinZ == 0 && MinY == 0;
+            isFullChunk = isFullChunk && LMaxX == (fInt)ChunkSize_X - 1 && LMaxZ == (fInt)ChunkSize_Z - 1 && MaxY == (fInt)ChunkSize_Y - 1;
+            if (isFullChunk && IN_SphereRadius < 0 && (IN_ReplaceID == F_VOXEL_EDIT_ANY || !ChunkPtr->isAllocated)) {
+                if (ChunkPtr->isAllocated) {
+                    _Internal_ReleaseBlockList(ChunkPtr->BlockList);
+                    ChunkPtr->BlockList = nullptr;
+                    ChunkPtr->isAllocated = false;
+                }
+                ChunkPtr->UniformBlock = IN_BlockID;
+                _Internal_BuildOccupancy(ChunkPtr);
+                _Internal_MarkDirty(CIndex, LMinX, MinY, LMinZ, LMaxX, MaxY, LMaxZ);
+                continue;
+            }
+
+            fInt Min[3] = { F_INT_MAX, F_INT_MAX, F_INT_MAX };
+            fInt Max[3] = { -1, -1, -1 };
+
+            for (fInt Y = MinY; Y <= MaxY && Result; Y++) {
+                for (fInt Z = LMinZ; Z <= LMaxZ; Z++) {
+                    fInt RowMinX = LMinX;
+                    fInt RowMaxX = LMaxX;
+
+                    // Clip the row to the sphere
+                    if (IN_SphereRadius >= 0) {
+                        fLong DY = Y - CenterY;
+                        fLong DZ = OriginZ + Z - CenterZ;
+                        fLong Rest = RadiusSq - (DY * DY) - (DZ * DZ);
+                        if (Rest < 0) { continue; }
+
+                        fLong Half = (fLong)std::sqrt((double)Rest);
+                        while (Half * Half > Rest) { Half--; }
+                        while ((Half + 1) * (Half + 1) <= Rest) { Half++; }
+
+                        RowMinX = (fInt)std::max<fLong>(RowMinX, CenterX - Half - OriginX);
+                        RowMaxX = (fInt)std::min<fLong>(RowMaxX, CenterX + Half - OriginX);
+                        if (RowMinX > RowMaxX) { continue; }
+                    }
+
+                    // Row writes may need the BlockList
+                    if (!ChunkPtr->isAllocated && !ChunkPtr->_Internal_AllocateBlockList()) { Result = false; break; }
+
+                    if (!_Internal_EditRow(ChunkPtr, RowMinX, RowMaxX, Y, Z, IN_BlockID, IN_ReplaceID)) { continue; }
+
+                    Min[0] = std::min(Min[0], RowMinX); Max[0] = std::max(Max[0], RowMaxX);
+                    Min[1] = std::min(Min[1], Y); Max[1] = std::max(Max[1], Y);
+                    Min[2] = std::min(Min[2], Z); Max[2] = std::max(Max[2], Z);
+                }
+            }
+
+            if (Max[0] >= 0) {
+                _Internal_BuildOccupancy(ChunkPtr, Min[1] / F_VOXEL_SECTION_SIZE_Y, Max[1] / F_VOXEL_SECTION_SIZE_Y);
+                _Internal_MarkDirty(CIndex, Min[0], Min[1], Min[2], Max[0], Max[1], Max[2]);
+            }
+            if (!Result) { return false; }
+        }
+    }
+
+    return Result;
+}
+fBool fVoxelWorld::_Internal_EditRow(fVoxelChunk* IN_Chunk, fUInt IN_MinX, fUInt IN_MaxX, fUInt IN_Y, fUInt IN_Z, fUInt IN_BlockID, fUInt IN_ReplaceID) {
+    fBool isChanged = false;
+
+    if (VoxelLayout == F_VOXEL_LAYOUT_LINEAR) {
+        // X rows are contiguous
+        fUInt* Row = IN_Chunk->BlockList + IN_Chunk->GetVoxelIndex(IN_MinX, IN_Y, IN_Z);
+        fUInt Num = IN_MaxX - IN_MinX + 1;
+
+        if (IN_ReplaceID == F_VOXEL_EDIT_ANY) {
+            for (fUInt X = 0; X < Num; X++) {
+                if (Row[X] != IN_BlockID) { isChanged = true; break; }
+            }
+            if (isChanged) { std::fill_n(Row, Num, IN_BlockID); }
+            return isChanged;
+        }
+
+        for (fUInt X = 0; X < Num; X++) {
+            if (Row[X] != IN_ReplaceID) { continue; }
+            Row[X] = IN_BlockID;
+            isChanged = true;
+        }
+        return isChanged;
+    }
+
+    for (fUInt X = IN_MinX; X <= IN_MaxX; X++) {
+        fUInt& Block = IN_Chunk->BlockList[IN_Chunk->GetVoxelIndex(X, IN_Y, IN_Z)];
+        if (IN_ReplaceID != F_VOXEL_EDIT_ANY && Block != IN_ReplaceID) { continue; }
+        if (Block == IN_BlockID) { continue; }
+        Block = IN_BlockID;
+        isChanged = true;
+    }
+    return isChanged;
+}
 fBool fVoxelWorld::SetChunkVoxelSize(fInt IN_X, fInt IN_Y, fInt IN_Z) {
     if (isInit) {
         Log(F_LOG_SEV_ERROR,"FVoxelWorld","SetChunkVoxelSize() => World properties cannot be changed after initialization");
@@ -1310,10 +3886,15 @@ fBool fVoxelWorld::SetChunkVoxelSize(fInt IN_X, fInt IN_Y, fInt IN_Z) {
         Log( F_LOG_SEV_ERROR, "FVoxelWorld", "Failed to Set Chunk VoxelSize. Invalid [Z] value. Value must be >= 0" );
         return false;
     }
+    if (isLayoutLocked && ((fUInt)IN_X != ChunkSize_X || (fUInt)IN_Y != ChunkSize_Y || (fUInt)IN_Z != ChunkSize_Z)) {
+        Log( F_LOG_SEV_ERROR, "FVoxelWorld", "Failed to Set Chunk VoxelSize. Size is locked (fVoxelWorldT)" );
+        return false;
+    }
 
     ChunkSize_X = IN_X;
     ChunkSize_Y = IN_Y;
     ChunkSize_Z = IN_Z;
+    _Internal_UpdateDividers();
 
     std::string C = "[" + std::to_string(IN_X) + "," + std::to_string(IN_Y) + "," + std::to_string(IN_Z) + "]";
     Log(F_LOG_SEV_DEBUG,"FVoxelWorld","World Chunk Size set to " + C);
@@ -1337,6 +3918,7 @@ fBool fVoxelWorld::SetRegionSize(fInt IN_X, fInt IN_Z) {
 
     RegionSize_X = IN_X;
     RegionSize_Z = IN_Z;
+    _Internal_UpdateDividers();
 
     std::string R = "[" + std::to_string(IN_X) + "," + std::to_string(IN_Z) + "]";
     Log(F_LOG_SEV_DEBUG,"FVoxelWorld","World Region Size set to " + R);
@@ -1366,6 +3948,65 @@ fBool fVoxelWorld::SetWorldSize(fInt IN_X, fInt IN_Z) {
 
     return true;
 }
+fBool fVoxelWorld::SetVoxelLayout(fUInt IN_Layout) {
+    if (isInit) {
+        Log(F_LOG_SEV_ERROR,"FVoxelWorld","SetVoxelLayout() => World properties cannot be changed after initialization");
+        return false;
+    }
+
+    if (IN_Layout != F_VOXEL_LAYOUT_LINEAR && IN_Layout != F_VOXEL_LAYOUT_BRICK) {
+        Log( F_LOG_SEV_ERROR, "FVoxelWorld", "Failed to Set Voxel Layout. Unknown layout [" + std::to_string(IN_Layout) + "]" );
+        return false;
+    }
+    if (isLayoutLocked && IN_Layout != VoxelLayout) {
+        Log( F_LOG_SEV_ERROR, "FVoxelWorld", "Failed to Set Voxel Layout. Layout is locked (fVoxelWorldT)" );
+        return false;
+    }
+
+    VoxelLayout = IN_Layout;
+    Log(F_LOG_SEV_DEBUG,"FVoxelWorld","World Voxel Layout set to [" + std::to_string(IN_Layout) + "]");
+
+    return true;
+}
+fBool fVoxelWorld::SetChunkPoolLimits(fUInt IN_MinChunks, fUInt IN_MaxChunks, fLong IN_MemoryBudget) {
+    if (IN_MaxChunks > 0 && IN_MinChunks > IN_MaxChunks) {
+        Log( F_LOG_SEV_ERROR, "FVoxelWorld", "Failed to Set Chunk Pool Limits. Min chunks must be <= Max chunks" );
+        return false;
+    }
+    if (IN_MemoryBudget < 0) {
+        Log( F_LOG_SEV_ERROR, "FVoxelWorld", "Failed to Set Chunk Pool Limits. Memory budget must be >= 0" );
+        return false;
+    }
+
+    ChunkPool_MinChunks = IN_MinChunks;
+    ChunkPool_MaxChunks = IN_MaxChunks;
+    ChunkPool_MemoryBudget = IN_MemoryBudget;
+
+    std::string P = "[" + std::to_string(IN_MinChunks) + "," + std::to_string(IN_MaxChunks) + "," + std::to_string(IN_MemoryBudget) + "]";
+    Log(F_LOG_SEV_DEBUG,"FVoxelWorld","Chunk Pool Limits set to " + P);
+
+    return true;
+}
+fBool fVoxelWorld::EnableBlockArena(fUInt IN_SlotCount, fBool IN_isHugePages) {
+    if (isInit) {
+        Log(F_LOG_SEV_ERROR,"FVoxelWorld","EnableBlockArena() => World properties cannot be changed after initialization");
+        return false;
+    }
+
+    BlockArena_isEnabled = true;
+    BlockArena_SlotCount = IN_SlotCount;
+    BlockArena_isHugePages = IN_isHugePages;
+    return true;
+}
+fBool fVoxelWorld::SetChunkPoolSlabSize(fUInt IN_SlabSize) {
+    if (IN_SlabSize == 0) {
+        Log( F_LOG_SEV_ERROR, "FVoxelWorld", "Failed to Set Chunk Pool Slab Size. Value must be > 0" );
+        return false;
+    }
+
+    ChunkPool_SlabSize = IN_SlabSize;
+    return true;
+}
 
 
 
@@ -1,15 +1,19 @@
 #pragma once
 
 #include <vector>
+#include <deque>
 #include <string>
 #include <cstdint>
 #include <mutex>
+#include <unordered_map>
+#include <functional>
 
 
 // ----------------------------------------------------------------------------------------------------
 // TypeDefs
 // ----------------------------------------------------------------------------------------------------
 
+#define F_INT_MAX		INT32_MAX
 #define F_LONG_MAX		INT64_MAX
 #define F_UINT_MAX		UINT32_MAX
 #define F_INT_MIN       INT32_MIN;
@@ -20,6 +24,55 @@
 #define F_LOG_SEV_ERROR			4
 #define F_LOG_SEV_UNDEFINED		255
 
+// Voxel layouts of a chunk's BlockList - Set before world creation and saved with the world
+#define F_VOXEL_LAYOUT_LINEAR		0	// Rows along X, ordered Y > Z > X
+#define F_VOXEL_LAYOUT_BRICK		1	// 4x4x4 bricks ordered Y > Z > X, voxels within a brick in Morton (Z-order)
+
+#define F_VOXEL_BRICK_SHIFT		2
+#define F_VOXEL_BRICK_SIZE		4
+#define F_VOXEL_BRICK_VOLUME	64
+
+// Number of voxels along Y in a single chunk section
+// Dirty state (and everything built on it) is tracked per section
+#define F_VOXEL_SECTION_SIZE_Y		16
+
+// Render passes - Chunk meshes can be generated as one sub mesh per pass
+#define F_VOXEL_PASS_OPAQUE				0
+#define F_VOXEL_PASS_CUTOUT				1
+#define F_VOXEL_PASS_TRANSLUCENT		2
+#define F_VOXEL_PASS_NUM				3
+
+// Number of lists in "fProcMesh" (Vertecies, Normals, UVs, AO, Colors, Packed, Indices)
+#define F_VOXEL_MESH_LIST_NUM			7
+
+// Minimum number of rays per thread of "fVoxelWorld::RaycastBatch()" - Fewer rays are not worth a thread
+#define F_VOXEL_RAYCAST_MIN_PER_THREAD	64
+
+// Minimum number of boxes per thread of "fVoxelWorld::SweepAABBBatch()"
+#define F_VOXEL_SWEEP_MIN_PER_THREAD	64
+
+// Number of chunks "fVoxelWorld::GetVoxels()" keeps resolved at once - Power of 2, 4x4 chunks around the queries
+#define F_VOXEL_GET_VOXELS_CACHE	16
+
+// Skin of "fVoxelWorld::SweepAABB()" in voxels - A box touching a voxel face does not overlap it
+#define F_VOXEL_SWEEP_EPSILON	0.0001F
+
+// Passed as "IN_ReplaceID" to the bulk edit functions to write every voxel regardless of its current value
+#define F_VOXEL_EDIT_ANY			(F_UINT_MAX - 1)
+
+// Chunk ticket levels - a chunk's level is the highest level of all tickets covering it
+#define F_CHUNK_TICKET_LEVEL_DATA		0	// Chunk data must stay loaded (e.g. for neighbour lookups)
+#define F_CHUNK_TICKET_LEVEL_FULL		1	// Chunk is actively used (e.g. rendered / simulated)
+#define F_CHUNK_TICKET_LEVEL_NUM		2
+
+// Chunk neighbour directions - Same order as the face meshes in "fVoxelWorld::VoxelMesh"
+// Opposite direction is "Direction ^ 1"
+#define F_VOXEL_NEIGHBOUR_FRONT		0	// Z-
+#define F_VOXEL_NEIGHBOUR_BACK		1	// Z+
+#define F_VOXEL_NEIGHBOUR_LEFT		2	// X+
+#define F_VOXEL_NEIGHBOUR_RIGHT		3	// X-
+#define F_VOXEL_NEIGHBOUR_NUM		4
+
 
 
 typedef int32_t		fInt;
@@ -46,15 +99,134 @@ struct fVector2ui { fUInt X = 0; fUInt Y = 0; };
 struct fVector3i { fInt X = 0; fInt Y = 0; fInt Z = 0; };
 struct fVector3ui { fUInt X = 0; fUInt Y = 0; fUInt Z = 0; };
 
+// Floor division / modulo by a positive divisor - Correct for negative values (unlike "/" and "%")
+inline fInt fVoxelFloorDiv(fInt IN_Value, fInt IN_Divisor) {
+    fInt Result = IN_Value / IN_Divisor;
+    if ((IN_Value % IN_Divisor) < 0) { Result--; }
+    return Result;
+}
+inline fInt fVoxelFloorMod(fInt IN_Value, fInt IN_Divisor) {
+    fInt Result = IN_Value % IN_Divisor;
+    if (Result < 0) { Result += IN_Divisor; }
+    return Result;
+}
+
+// Floor division / modulo by a fixed positive size (Chunk / Region size)
+// Uses shift and mask when the size is a power of 2
+struct fVoxelAxisDivider {
+    fInt Size = 1;
+    // -1 if Size is not a power of 2
+    fInt Shift = 0;
+    // 1.0 / Size - Used by the batch conversion
+    double InvSize = 1.0;
+
+    fVoxelAxisDivider(fUInt IN_Size = 1) { Set(IN_Size); }
+    void Set(fUInt IN_Size);
+
+    fInt Div(fInt IN_Value) const { return Shift >= 0 ? (IN_Value >> Shift) : fVoxelFloorDiv(IN_Value, Size); }
+    fInt Mod(fInt IN_Value) const { return Shift >= 0 ? (IN_Value & (Size - 1)) : fVoxelFloorMod(IN_Value, Size); }
+
+    // Div and Mod for IN_Num values - SIMD when available
+    void DivMod(const fInt* IN_Values, fInt* OUT_Div, fInt* OUT_Mod, size_t IN_Num) const;
+};
+
+// Packed chunk mesh vertex - 8 bytes instead of the 32 bytes of Position + Normal + UV
+//      A: X (bits 0-9), Y (bits 10-21), Z (bits 22-31) - Chunk local voxel corner
+//      B: Face (bits 0-2), Corner (bits 3-4), TileX (bits 5-12), TileY (bits 13-20), AO (bits 21-22), Light (bits 23-30), Reserved (bit 31)
+// Face is the index into "fVoxelWorld::VoxelMesh" (0-6), Corner is the UV corner within the tile (bit 0 = U, bit 1 = V)
+// See "fVoxelWorld::UnpackVertex()" to get back Position, Normal and UV
+struct fVoxelPackedVertex {
+    fUInt A = 0;
+    fUInt B = 0;
+
+    fUInt GetX() const { return A & 0x3FF; }
+    fUInt GetY() const { return (A >> 10) & 0xFFF; }
+    fUInt GetZ() const { return A >> 22; }
+    fUInt GetFace() const { return B & 0x7; }
+    fUInt GetCorner() const { return (B >> 3) & 0x3; }
+    fUInt GetTileX() const { return (B >> 5) & 0xFF; }
+    fUInt GetTileY() const { return (B >> 13) & 0xFF; }
+    fUInt GetAO() const { return (B >> 21) & 0x3; }
+    fUInt GetSkyLight() const { return (B >> 27) & 0xF; }
+    fUInt GetBlockLight() const { return (B >> 23) & 0xF; }
+    fUInt GetReserved() const { return B >> 31; }
+
+    static fUInt PackPosition(fUInt IN_X, fUInt IN_Y, fUInt IN_Z) { return IN_X | (IN_Y << 10) | (IN_Z << 22); }
+    static fUInt PackTile(fUInt IN_TileX, fUInt IN_TileY) { return ((IN_TileX & 0xFF) << 5) | ((IN_TileY & 0xFF) << 13); }
+};
+
+// Limits of the packed vertex position - Max chunk size usable with packed output
+#define F_VOXEL_PACKED_MAX_X		1023
+#define F_VOXEL_PACKED_MAX_Y		4095
+#define F_VOXEL_PACKED_MAX_Z		1023
+
+// Vertex colour of lit chunk meshes - R = Sky light, G = Block light (0-15 scaled to 0-255), B = A = 255
+struct fVoxelColor { fUChar R = 255; fUChar G = 255; fUChar B = 255; fUChar A = 255; };
+
 struct fProcMesh {
     std::vector<fVector3> Vertecies;
     std::vector<fVector3> Normals;
     std::vector<fVector2> UVs;
 
+    // Ambient occlusion of each vertex (0 = fully occluded, 3 = not occluded) - Only filled if "fVoxelWorld::SetAmbientOcclusion(true)"
+    std::vector<fUChar> AO;
+
+    // Light of the voxel in front of the face of each vertex (see "fVoxelColor") - Only filled if "fVoxelWorld::SetLighting(true)"
+    std::vector<fVoxelColor> Colors;
+
+    // Vertices of packed meshes - Used instead of Vertecies / Normals / UVs / AO / Colors
+    std::vector<fVoxelPackedVertex> Packed;
+
+    // Triangle list into Vertecies (or Packed) - Empty for non-indexed meshes (every 3 vertices is a triangle)
+    std::vector<fUInt> Indices;
+
+    // Appends REF_Other - Indices of REF_Other are offset by the current number of vertices
+    // NOTE: Both meshes are expected to be either indexed or non-indexed
     fProcMesh& operator+=(const fProcMesh& REF_Other);
+
+    fBool GetisIndexed() const { return Indices.size() > 0; }
+    fBool GetisPacked() const { return Packed.size() > 0; }
+    fUInt GetVertexNum() const { return Vertecies.size() + Packed.size(); }
+
+    // Return an indexed copy of this mesh with identical vertices (Position, Normal, UV, AO and Color) merged
+    fProcMesh GetIndexed() const;
 };
 
 
+// Single vertex attribute written by "fVoxelWorld::GenerateChunkMesh(fUInt, fVoxelMeshSink&)"
+struct fVoxelMeshStream {
+    // Start of the buffer - nullptr to skip this attribute
+    void* Data = nullptr;
+
+    // Bytes between two vertices (0 = tightly packed) and bytes from the start of a vertex to this attribute
+    fUInt Stride = 0;
+    fUInt Offset = 0;
+};
+
+struct fVoxelMeshSink;
+
+// Called when the sink has no room for IN_Required more vertices
+// Must either grow the buffers (update Data / Capacity) or consume the written vertices (reset VertexNum)
+// Return false to abort the mesh generation
+typedef fBool (*fVoxelMeshSinkCallback)(fVoxelMeshSink& REF_Sink, fUInt IN_Required);
+
+// Caller owned buffers the mesher writes into directly, without building a fProcMesh
+// Attributes can be interleaved (same Data, Stride = vertex size, different Offset) or separate
+struct fVoxelMeshSink {
+    fVoxelMeshStream Position;  // 3 x fFloat
+    fVoxelMeshStream Normal;    // 3 x fFloat
+    fVoxelMeshStream UV;        // 2 x fFloat
+    fVoxelMeshStream AO;        // 1 x fFloat - 0.0 (fully occluded) to 1.0 - Only written with ambient occlusion enabled
+    fVoxelMeshStream Color;     // 4 x fUChar - see "fVoxelColor" - Only written with lighting enabled
+
+    // Number of vertices the buffers can hold / number of vertices written so far
+    fUInt Capacity = 0;
+    fUInt VertexNum = 0;
+
+    fVoxelMeshSinkCallback OnFull = nullptr;
+    void* UserData = nullptr;
+};
+
 // ----------------------------------------------------------------------------------------------------
 // fVoxel Internal Defs
 // ----------------------------------------------------------------------------------------------------
@@ -136,9 +308,72 @@ public:
 };
 
 
+// Horizontal slice of a chunk, F_VOXEL_SECTION_SIZE_Y voxels high
+struct fVoxelSection {
+    // Voxels changed since the section has been saved
+    fBool isModified = false;
+
+    // Section (or a voxel bordering it) changed since "Mesh" has been generated
+    fBool isMeshDirty = true;
+
+    // Light of each voxel (Y > Z > X) - Sky light in the high 4 bits, Block light in the low 4 bits
+    // Empty until the chunk is lit - see "fVoxelWorld::LightChunk()"
+    std::vector<fUChar> LightList;
+
+    // Solid voxels of the section, one bit each (Y > Z > X) - Kept up to date by edits
+    std::vector<fUInt> SolidBits;
+
+    // Number of voxels in the section, and how many of them are solid / opaque
+    fUInt VoxelNum = 0;
+    fUInt SolidCount = 0;
+    fUInt OpaqueCount = 0;
+
+    // Number of voxels of each Block ID in the section as pairs of {Count,ID} (Air is F_UINT_MAX)
+    std::vector<fVector2ui> BlockCountList;
+
+    // Mesh segment of the section for each render pass - Only kept by "fVoxelWorld::UpdateChunkMesh()"
+    fProcMesh PassMesh[F_VOXEL_PASS_NUM];
+    fUInt VisibleVoxels = 0;
+
+    // Changes every time PassMesh is generated again (0 = never generated) - see "fVoxelSpliceState"
+    fUInt MeshID = 0;
+};
+
+// Section mesh spliced into the output of "fVoxelWorld::UpdateChunkMesh()"
+struct fVoxelSpliceEntry {
+    // "fVoxelSection::MeshID" at the time of the splice
+    fUInt MeshID = 0;
+
+    // Number of elements in each list of the section mesh - Vertecies, Normals, UVs, AO, Colors, Packed, Indices
+    fUInt Size[F_VOXEL_MESH_LIST_NUM] = {0};
+};
+
+// Layout of the mesh last built from the section meshes of a chunk by "fVoxelWorld::UpdateChunkMesh()"
+// Lets the next update replace only the sections generated again, in place
+struct fVoxelSpliceState {
+    // Mesh spliced into - nullptr if none yet
+    const fProcMesh* Mesh = nullptr;
+
+    // One entry for each spliced section mesh, in splice order (pass by pass)
+    std::vector<fVoxelSpliceEntry> EntryList;
+};
+
 // Represents a single Chunk in the World
 class fVoxelChunk {
+    friend class fVoxelWorld;
 protected:
+    // Same as "SetBlock()" / "AllocateBlockList()" without flagging the chunk as written directly
+    // Used by the world, which keeps the heightmap and section occupancy up to date itself
+    fBool _Internal_SetBlock(fUInt IN_Index, fUInt IN_BlockID) {
+        if (!isAllocated) {
+            if (IN_BlockID == UniformBlock) { return true; }
+            if (!_Internal_AllocateBlockList()) { return false; }
+        }
+        BlockList[IN_Index] = IN_BlockID;
+        return true;
+    }
+    fBool _Internal_AllocateBlockList();
+
     // Compress Chunk data (BlockList) into a pair of {Count,ID}
     fBool _Internal_CompressData(std::vector<fVector2ui>& REF_Data);
 
@@ -162,23 +397,92 @@ public:
     fInt PosZ = F_INT_MIN;
 
     // Blocklist (Each element is an index / UID of that block)
+    // Only allocated once a voxel differs from "UniformBlock" - NULLPTR until then
     fUInt* BlockList = nullptr;
 
+    // Block ID of every voxel while BlockList is not allocated (F_UINT_MAX = Air)
+    fUInt UniformBlock = F_UINT_MAX;
+
+    // Number of tickets holding this chunk for each ticket level
+    // Chunk is scheduled for unload when all of these drops to 0
+    fUInt TicketCount[F_CHUNK_TICKET_LEVEL_NUM] = {0};
+
+    // Changes every time the chunk is spawned - Lets a ticket tell a respawned chunk from the one it holds
+    fUInt SpawnID = 0;
+
+    // Sections from bottom to top - Section Index = LocalY / F_VOXEL_SECTION_SIZE_Y
+    std::vector<fVoxelSection> SectionList;
+
+    // Output meshes of "fVoxelWorld::UpdateChunkMesh()" - One for each render pass, then one for all passes in one mesh
+    fVoxelSpliceState SpliceList[F_VOXEL_PASS_NUM + 1];
+
+    // Highest solid / highest non Air voxel Y of each column (Z * ChunkSize_X + X), -1 if none
+    // Built by "fVoxelWorld::SpawnChunk()" and kept up to date by edits
+    std::vector<fInt> SolidHeightList;
+    std::vector<fInt> TopHeightList;
+
+    // Highest value of TopHeightList - Kept up to date with it
+    fInt MaxHeight = -1;
+
+    // BlockList has been written from outside the world ("SetBlock()" / "AllocateBlockList()")
+    // The heightmap and section occupancy are rebuilt before they are used next
+    // see "fVoxelWorld::UpdateChunkHeightmap()" and "fVoxelWorld::UpdateChunkOccupancy()"
+    fBool isHeightmapDirty = false;
+    fBool isOccupancyDirty = false;
+
+    // Loaded chunks next to this one (nullptr if not loaded) - Indexed by F_VOXEL_NEIGHBOUR_*
+    // Kept up to date by "fVoxelWorld::SpawnChunk()" and "fVoxelWorld::UnloadChunk()"
+    fVoxelChunk* NeighbourList[F_VOXEL_NEIGHBOUR_NUM] = {nullptr};
+
     // Flags
     fBool isExist = false;
     fBool isModified = false;
+    fBool isMeshDirty = true;
     fBool isAllocated = false;
     fBool isVoxelGenerated = false;
     fBool isMeshGenerated = false;
+    fBool isLightReady = false;     // Section LightLists are filled and kept up to date by edits
 
     fVoxelChunk(fVoxelWorld* IN_WorldPtr) { WorldPtr = IN_WorldPtr; }
 
+    // Return the highest ticket level holding this chunk, or F_UINT_MAX if not held by any ticket
+    fUInt GetTicketLevel();
+
+    // Return true if all 4 neighbours are loaded - Border faces can only be meshed correctly from then
+    fBool GetisNeighboursReady() {
+        for (fUInt X = 0; X < F_VOXEL_NEIGHBOUR_NUM; X++) { if (NeighbourList[X] == nullptr) { return false; } }
+        return true;
+    }
+
     // Utility info mainly for debuging
     fUInt VisibleVoxels = 0;    // Number of voxel with any mesh generated - Populated from "_Internal_GenerateVoxel()"
 
     // Return the Index into BlockList for the specified Voxel
     fUInt GetVoxelIndex(fUInt IN_X, fUInt IN_Y, fUInt IN_Z);
 
+    // Return the local position of the Voxel at IN_Index in BlockList - Reverse of GetVoxelIndex
+    // NOTE: With F_VOXEL_LAYOUT_BRICK, indices of the padding around the chunk returns positions outside the chunk
+    fVector3ui GetVoxelPosition(fUInt IN_Index);
+
+    // Return the Block ID at IN_Index (Index from GetVoxelIndex)
+    fUInt GetBlock(fUInt IN_Index) { return isAllocated ? BlockList[IN_Index] : UniformBlock; }
+
+    // Sets the Block ID at IN_Index (Index from GetVoxelIndex)
+    // Allocates BlockList on the first write differing from "UniformBlock". Return false if allocation failed
+    fBool SetBlock(fUInt IN_Index, fUInt IN_BlockID) {
+        isHeightmapDirty = true;
+        isOccupancyDirty = true;
+        return _Internal_SetBlock(IN_Index, IN_BlockID);
+    }
+
+    // Allocates BlockList filled with "UniformBlock" if not yet allocated
+    // Must be called before writing BlockList directly
+    fBool AllocateBlockList() {
+        isHeightmapDirty = true;
+        isOccupancyDirty = true;
+        return _Internal_AllocateBlockList();
+    }
+
     // Save Data into Region Data File
     fBool SaveChunkData();
 
@@ -192,10 +496,94 @@ public:
 struct fVoxelBlock {
     fUInt UID = 0;
     std::string Name = "";
+
+    // Atlas tile of the side faces (and "Always" mesh) / of the top (Y+) face / of the bottom (Y-) face
     fVector2ui Texture = {0,0};
+    fVector2ui TextureTop = {0,0};
+    fVector2ui TextureBottom = {0,0};
+
     fUChar Flags = 0b00000000;
 
+    // Same texture on every face
     fVoxelBlock(fUInt IN_UID = 0, std::string IN_Name = "", fVector2ui IN_Texture = {0,0}, fUChar IN_Flags = 0b00000000);
+    fVoxelBlock(fUInt IN_UID, std::string IN_Name, fVector2ui IN_TextureSide, fVector2ui IN_TextureTop, fVector2ui IN_TextureBottom, fUChar IN_Flags = 0b00000000);
+};
+
+// fVoxelBlock::Flags
+#define F_VOXEL_BLOCK_NON_SOLID			0x01	// Does not collide
+#define F_VOXEL_BLOCK_TRANSPARENT		0x02	// Does not hide the faces of the blocks next to it
+#define F_VOXEL_BLOCK_CUTOUT			0x04	// Rendered in F_VOXEL_PASS_CUTOUT (alpha tested - leaves, grass)
+#define F_VOXEL_BLOCK_TRANSLUCENT		0x08	// Rendered in F_VOXEL_PASS_TRANSLUCENT (alpha blended - glass, water)
+#define F_VOXEL_BLOCK_LIGHT_SHIFT		4		// Bits 4-7 - Light emitted by the block (0-15)
+#define F_VOXEL_BLOCK_LIGHT_MASK		0xF0
+
+// Number of entries per Block ID in the UV table (7 faces, padded to 8)
+#define F_VOXEL_UV_TABLE_STRIDE		8
+
+// Final UV rectangle of a face: UV = (U,V) + (Mesh UV * (StepU,StepV))
+struct alignas(16) fVoxelUVRect {
+    fFloat U = 0.0F;
+    fFloat V = 0.0F;
+    fFloat StepU = 1.0F;
+    fFloat StepV = 1.0F;
+};
+
+// Block properties compiled from the VoxelList into flat arrays for the hot paths (meshing, lighting, physics)
+// Every array is indexed by Slot = Block ID + 1, so Air (F_UINT_MAX) is always slot 0
+// Block IDs not in the VoxelList are treated as solid and opaque without texture
+class fVoxelBlockRegistry {
+protected:
+    fUInt SlotNum = 0;
+
+    std::vector<fUChar> FlagList;
+    std::vector<fUChar> SolidList;
+    std::vector<fUChar> OpaqueList;
+    std::vector<fUChar> LightList;
+    std::vector<fUChar> SelfCullList;
+    std::vector<fUChar> PassList;
+
+    // F_VOXEL_UV_TABLE_STRIDE entries per slot - UV rectangle / packed tile bits of each face
+    std::vector<fVoxelUVRect> UVRectList;
+    std::vector<fUInt> TileList;
+
+    // Name -> Block ID - For tooling, not used by the engine itself
+    std::unordered_map<std::string, fUInt> NameMap;
+
+public:
+    fVoxelBlockRegistry() { Build(std::vector<fVoxelBlock>(), 1.0F, 1.0F); }
+
+    // Rebuilds every array - Block ID is the index in IN_BlockList
+    void Build(const std::vector<fVoxelBlock>& REF_BlockList, fFloat IN_TextureStepX, fFloat IN_TextureStepY);
+
+    static fUInt GetSlot(fUInt IN_BlockID) { return IN_BlockID + 1; }
+
+    fUInt GetBlockNum() const { return SlotNum - 1; }
+    fBool GetisSolid(fUInt IN_BlockID) const { fUInt S = GetSlot(IN_BlockID); return S >= SlotNum || SolidList[S]; }
+    fBool GetisOpaque(fUInt IN_BlockID) const { fUInt S = GetSlot(IN_BlockID); return S >= SlotNum || OpaqueList[S]; }
+    fUInt GetLight(fUInt IN_BlockID) const { fUInt S = GetSlot(IN_BlockID); return S < SlotNum ? LightList[S] : 0; }
+    fUChar GetFlags(fUInt IN_BlockID) const { fUInt S = GetSlot(IN_BlockID); return S < SlotNum ? FlagList[S] : 0; }
+    fUInt GetPass(fUInt IN_BlockID) const { fUInt S = GetSlot(IN_BlockID); return S < SlotNum ? PassList[S] : F_VOXEL_PASS_OPAQUE; }
+
+    // Return true if the face of IN_BlockID towards IN_NeighbourID is not visible
+    // Hidden by opaque neighbours, and by the same block unless it is a cutout block
+    fBool GetisFaceHidden(fUInt IN_BlockID, fUInt IN_NeighbourID) const {
+        if (GetisOpaque(IN_NeighbourID)) { return true; }
+        fUInt S = GetSlot(IN_BlockID);
+        return IN_BlockID == IN_NeighbourID && S < SlotNum && SelfCullList[S];
+    }
+
+    // Return the F_VOXEL_UV_TABLE_STRIDE entries of the block, nullptr for Air and unknown IDs
+    const fVoxelUVRect* GetUVRects(fUInt IN_BlockID) const {
+        fUInt S = GetSlot(IN_BlockID);
+        return (S == 0 || S >= SlotNum) ? nullptr : &UVRectList[S * F_VOXEL_UV_TABLE_STRIDE];
+    }
+    const fUInt* GetTiles(fUInt IN_BlockID) const {
+        fUInt S = GetSlot(IN_BlockID);
+        return (S == 0 || S >= SlotNum) ? nullptr : &TileList[S * F_VOXEL_UV_TABLE_STRIDE];
+    }
+
+    // Return the Block ID registered with IN_Name, F_UINT_MAX if not found
+    fUInt GetBlockID(const std::string& REF_Name) const;
 };
 
 // Position of a single Vooxel in Within its chunks
@@ -217,6 +605,167 @@ struct fVoxelGlobalPos {
 };
 
 
+// A request to keep an area of chunks loaded
+// Created with "AcquireChunk()" and given back with "ReleaseChunk()"
+struct fVoxelChunkTicket {
+    // Center Chunk Position X,Z
+    fInt PosX = 0;
+    fInt PosZ = 0;
+
+    // One of F_CHUNK_TICKET_LEVEL_*
+    fUInt Level = F_CHUNK_TICKET_LEVEL_DATA;
+
+    // Number of chunks around the center chunk covered by this ticket
+    fUInt Radius = 0;
+
+    // Chunk positions this ticket is actually holding (chunks failed to spawn are not held)
+    std::vector<fVector2i> ChunkPosList;
+
+    // "fVoxelChunk::SpawnID" of each held chunk when it was acquired - Same order as ChunkPosList
+    std::vector<fUInt> ChunkSpawnList;
+
+    fBool isActive = false;
+};
+
+// Voxel waiting in one of the light queues of "fVoxelWorld"
+struct fVoxelLightNode {
+    fVoxelChunk* Chunk = nullptr;
+
+    // Chunk local position
+    fUInt X = 0;
+    fUInt Y = 0;
+    fUInt Z = 0;
+
+    // Light level before removal - Only used by the removal queue
+    fUInt Level = 0;
+};
+
+// Single voxel write for "fVoxelWorld::ApplyEdits()"
+struct fVoxelEdit {
+    // Global Voxel Position
+    fInt X = 0;
+    fInt Y = 0;
+    fInt Z = 0;
+
+    // Block ID to write (F_UINT_MAX = Air)
+    fUInt BlockID = F_UINT_MAX;
+};
+
+// Single ray for "fVoxelWorld::RaycastBatch()"
+struct fVoxelRay {
+    // World units - Voxel X spans [X * VoxelSize_X, (X + 1) * VoxelSize_X)
+    fVector3 Origin;
+
+    // Does not need to be normalised
+    fVector3 Direction;
+
+    fFloat MaxDistance = 0.0F;
+};
+
+// Result of "fVoxelWorld::Raycast()"
+struct fVoxelRayHit {
+    fBool isHit = false;
+
+    // Global position and Block ID of the voxel hit
+    fVoxelGlobalPos Voxel;
+    fUInt BlockID = F_UINT_MAX;
+
+    // Face of the voxel the ray entered through (index into "fVoxelWorld::VoxelMesh", 0-5)
+    // F_UINT_MAX if the ray started inside the voxel
+    fUInt Face = F_UINT_MAX;
+
+    // World units from the ray origin
+    fFloat Distance = 0.0F;
+};
+
+// Axis aligned box in world units
+struct fVoxelAABB {
+    fVector3 Min;
+    fVector3 Max;
+};
+
+// Result of "fVoxelWorld::SweepAABB()"
+struct fVoxelSweepResult {
+    // Box after the move and the movement actually applied
+    fVoxelAABB Box;
+    fVector3 Delta;
+
+    // Normal of the voxel faces the box came to rest against per axis (-1, 0, +1)
+    // ie. Normal.Y == 1 when standing on the ground
+    fVector3i Normal;
+
+    fBool isCollided = false;
+};
+
+// Usage info of the BlockList arena - see "fVoxelWorld::EnableBlockArena()"
+struct fVoxelArenaStats {
+    // Number of bytes reserved for the arena
+    fLong ReservedBytes = 0;
+
+    // Size of a single slot in bytes (BlockList size rounded up to page size)
+    fLong SlotSize = 0;
+
+    // Total number of slots / number of slots currently handed out / highest number of slots handed out
+    fUInt SlotCount = 0;
+    fUInt SlotsInUse = 0;
+    fUInt PeakSlotsInUse = 0;
+
+    // Number of BlockLists allocated with "Allocator" because the arena was full
+    fLong FallbackAllocs = 0;
+
+    // Region is backed by explicit huge pages (MAP_HUGETLB) / Transparent huge pages requested (MADV_HUGEPAGE)
+    fBool isHugePages = false;
+    fBool isTransparentHugePages = false;
+};
+
+// Fixed size slot allocator for BlockLists
+// Reserves one large region up front and hands out slots of that region
+// Freed slots are kept in a free list and reused, their physical pages given back to the OS where possible
+class fVoxelBlockArena {
+protected:
+    fUChar* RegionPtr = nullptr;
+    fLong SlotSize = 0;
+    fUInt SlotCount = 0;
+
+    // True if the region is mapped directly from the OS, false if allocated with the world "Allocator"
+    fBool isMapped = false;
+
+    // Indices of slots not handed out - used as a stack so recently freed slots are reused first
+    std::vector<fUInt> FreeSlotList;
+
+    fVoxelArenaStats Stats;
+public:
+    // Reserves the region
+    //      @ IN_SlotSize - Number of bytes needed per slot (rounded up to page size)
+    //      @ IN_SlotCount - Number of slots
+    //      @ IN_isHugePages - Try to back the region with huge pages
+    //      @ IN_Allocator - Used if the region cannot be mapped from the OS directly
+    fBool Reserve(fLong IN_SlotSize, fUInt IN_SlotCount, fBool IN_isHugePages, fMemoryAllocator IN_Allocator);
+
+    // Gives back the whole region. All slots must have been freed before
+    void Release(fMemoryDeAllocator IN_DeAllocator);
+
+    // Return a free slot or NULLPTR if the arena is full
+    void* Alloc();
+
+    // Return IN_Ptr to the free list. Return false if IN_Ptr is not a slot of this arena
+    fBool Free(void* IN_Ptr);
+
+    fBool isOwned(void* IN_Ptr);
+    fBool isReserved() { return RegionPtr != nullptr; }
+    fVoxelArenaStats& GetStats() { return Stats; }
+};
+
+// A BlockList allocation no longer used by any chunk
+// Kept by the world for reuse until it has been idle for "ChunkPool_IdleTime"
+struct fVoxelCachedBlockList {
+    fUInt* BlockList = nullptr;
+
+    // Time (in milliseconds) the BlockList has been released
+    fLong ReleaseTime = 0;
+};
+
+
 // ----------------------------------------------------------------------------------------------------
 // External Interface Class - Main Class
 // ----------------------------------------------------------------------------------------------------
@@ -226,13 +775,43 @@ struct fVoxelGlobalPos {
 class fVoxelWorld {
 private:
     // Total number of Chunks exist in memory at any one time
-    // Calculated as "WorldSize_X*WorldSize_Z" in "_Internal_Init()"
+    // Equals to ChunkList.size(), grows and shrinks with the chunk pool
     fLong ChunksPerWorld = 0;
 
     // Total number of Blocks per chunks
     // Calculated as "ChunkSize_X*ChunkSize_Y*ChunkSize_Z" in "_Internal_Init()"
+    // With F_VOXEL_LAYOUT_BRICK each size is rounded up to a whole number of bricks
     fLong BlocksPerChunk = 0;
 
+    // Number of sections per chunk
+    // Calculated as "ChunkSize_Y / F_VOXEL_SECTION_SIZE_Y" (rounded up) in "_Internal_Init()"
+    fUInt SectionsPerChunk = 0;
+
+    // Number of bricks along X and Z - Only used with F_VOXEL_LAYOUT_BRICK
+    // Calculated in "_Internal_Init()"
+    fUInt LayoutBricks_X = 0;
+    fUInt LayoutBricks_Z = 0;
+
+    // Padded section volume used by the mesher - see "_Internal_GatherSection()"
+    std::vector<fUInt> MeshScratch;
+    fUInt MeshPad_X = 0;
+    fUInt MeshPad_Z = 0;
+
+    // Compiled VoxelList - Rebuilt by "_Internal_UpdateRegistry()" when the VoxelList or the texture steps change
+    fVoxelBlockRegistry BlockRegistry;
+
+    // Per voxel mesh used when generating into a fVoxelMeshSink
+    fProcMesh SinkScratch;
+
+    // Cutout and translucent faces of "GenerateChunkMesh(fUInt, fProcMesh&)", appended after the opaque ones
+    fProcMesh PassScratch[F_VOXEL_PASS_NUM - 1];
+
+    // Last "fVoxelSection::MeshID" handed out by "_Internal_UpdateSectionMeshes()"
+    fUInt LastSectionMeshID = 0;
+
+    // Splice state that last built each output mesh of "UpdateChunkMesh()" - A mesh is only patched by its own state
+    std::unordered_map<const fProcMesh*, const fVoxelSpliceState*> SpliceOwnerMap;
+
     // Number of vertecies in each SubMesh
     // To avoid counting them for each voxel when mesh generation
     // Populated from "_Internal_CalculateTempVerts()"
@@ -254,11 +833,30 @@ protected:
     fUInt ChunkSize_Y = 256;
     fUInt ChunkSize_Z = 33;
 
+    // Order of voxels in a chunk's BlockList - One of F_VOXEL_LAYOUT_*
+    fUInt VoxelLayout = F_VOXEL_LAYOUT_LINEAR;
+
+    // Chunk size and layout can not be changed or loaded different - Set by fVoxelWorldT, its index math is built on them
+    fBool isLayoutLocked = false;
+
     // Number of Chunks Per Region
     fUInt RegionSize_X = 16;
     fUInt RegionSize_Z = 16;
 
+    // Integer global -> chunk / chunk -> region conversion for the sizes above
+    // Updated with "_Internal_UpdateDividers()" whenever a size changes
+    fVoxelAxisDivider ChunkDiv_X = fVoxelAxisDivider(ChunkSize_X);
+    fVoxelAxisDivider ChunkDiv_Z = fVoxelAxisDivider(ChunkSize_Z);
+    fVoxelAxisDivider RegionDiv_X = fVoxelAxisDivider(RegionSize_X);
+    fVoxelAxisDivider RegionDiv_Z = fVoxelAxisDivider(RegionSize_Z);
+
+    // Shift of Z and Y in a F_VOXEL_LAYOUT_LINEAR voxel index - -1 unless ChunkSize_X / ChunkSize_Z are powers of 2
+    // Lets the index math of every path (meshing, edits, raycasts...) use shifts and masks - see "_Internal_GetVoxelIndex()"
+    fInt IndexShift_Z = -1;
+    fInt IndexShift_Y = -1;
+
     // Number of Chunks That can be loaded at any one time
+    // Used as the chunk pool limits unless changed with "SetChunkPoolLimits()"
     fUInt WorldSize_X = 32;
     fUInt WorldSize_Z = 32;
 
@@ -315,6 +913,28 @@ protected:
     // 6 - Always Visible
     fProcMesh VoxelMesh[7];
 
+    // Indexed copy of VoxelMesh - Used by the mesher if "isIndexedMesh" is set
+    fProcMesh VoxelMeshIndexed[7];
+    fBool isIndexedMesh = false;
+
+    // Packed copies of VoxelMesh / VoxelMeshIndexed - Used by the mesher if "isPackedMesh" is set
+    fProcMesh VoxelMeshPacked[7];
+    fProcMesh VoxelMeshPackedIndexed[7];
+    fBool isPackedMesh = false;
+
+    // Bake per vertex ambient occlusion into the chunk meshes - see "SetAmbientOcclusion()"
+    fBool isAmbientOcclusion = false;
+
+    // Flood fill sky / block light - see "SetLighting()"
+    fBool isLighting = false;
+
+    // Light BFS queues - Processed front to back, cleared once empty
+    std::vector<fVoxelLightNode> LightAddQueue;
+    std::vector<fVoxelLightNode> LightRemoveQueue;
+
+    // Padded section light used by the mesher - same layout as MeshScratch
+    std::vector<fUChar> LightScratch;
+
     std::vector<fVoxelBlock> VoxelList;
 
     // Root folder for save Data
@@ -322,10 +942,57 @@ protected:
     std::string SavePath = "";
 
     // List of Chunks Currentl "Present" in memory
-    std::vector<fVoxelChunk> ChunkList;
+    // Points into ChunkSlabList, so pointers stays valid while the pool grows
+    std::vector<fVoxelChunk*> ChunkList;
+
+    // Storage for the chunks. Each slab is allocated at once and never resized
+    std::vector<std::vector<fVoxelChunk>> ChunkSlabList;
+
+    // Index into ChunkList for each existing chunk - Key from "_Internal_GetChunkKey()"
+    std::unordered_map<fLong, fUInt> ChunkMap;
+
+    // Index of the chunk found by the last "_Internal_GetChunkIndex()" - Most lookups hit the same chunk in a row
+    fUInt LastChunkIndex = F_UINT_MAX;
+
+    // ----------------------------------------------------------------------------
+    // Chunk Pool - Can be changed on the fly
+
+    // Min / Max number of chunks in ChunkList
+    // 0 = use "WorldSize_X*WorldSize_Z"
+    fUInt ChunkPool_MinChunks = 0;
+    fUInt ChunkPool_MaxChunks = 0;
+
+    // Max number of bytes to allocate for BlockLists (In use and cached)
+    // 0 = no limit
+    fLong ChunkPool_MemoryBudget = 0;
+
+    // Number of seconds a released BlockList is kept before returned to "DeAllocator"
+    fFloat ChunkPool_IdleTime = 30.0F;
+
+    // Number of chunks allocated at once when the pool needs to grow
+    fUInt ChunkPool_SlabSize = 16;
+
+    // Number of bytes currently allocated for BlockLists (In use and cached)
+    fLong ChunkPool_AllocatedBytes = 0;
+
+    // BlockLists released by unloaded chunks, waiting to be reused or deallocated
+    std::vector<fVoxelCachedBlockList> BlockListCache;
 
     // List of Regions Currentl "Present" in memory
-    std::vector<fVoxelRegionData> RegionList;
+    // Chunks keep pointers to their region, so elements must not move when a region is added
+    std::deque<fVoxelRegionData> RegionList;
+
+    // ----------------------------------------------------------------------------
+    // Chunk Tickets
+
+    // List of tickets - Ticket ID is the index into this list, inactive entries are reused
+    std::vector<fVoxelChunkTicket> TicketList;
+
+    // Positions of chunks whose last ticket has been released, unloaded by "UpdateChunkTickets()"
+    std::vector<fVector2i> PendingUnloadList;
+
+    // Last "fVoxelChunk::SpawnID" handed out by "SpawnChunk()"
+    fUInt LastSpawnID = 0;
 
     // ----------------------------------------------------------------------------
     // I/O Related Stuff
@@ -407,6 +1074,17 @@ protected:
     static void* DefaultMemAllocator(size_t IN_Bytes) { return malloc(IN_Bytes); }
     static void DefaultMemDeAllocator(void* IN_Ptr) { free(IN_Ptr); }
 
+    // Optional slot allocator for BlockLists - reserved in "_Internal_Init()" if enabled
+    fVoxelBlockArena BlockArena;
+    fBool BlockArena_isEnabled = false;
+    fBool BlockArena_isHugePages = false;
+    // Number of slots to reserve. 0 = max size of the chunk pool
+    fUInt BlockArena_SlotCount = 0;
+
+    // Allocates / Deallocates a single BlockList from the arena if enabled, with "Allocator" / "DeAllocator" otherwise
+    fUInt* _Internal_AllocBlockList();
+    void _Internal_FreeBlockList(fUInt* IN_BlockList);
+
     // ----------------------------------------------------------------------------
     // Util Functions
 
@@ -427,6 +1105,9 @@ protected:
     // Calculates the Number of Vertecies in FoxelMesh array
     void _Internal_CalculateTempVerts();
 
+    // Sets ChunkDiv_* and RegionDiv_* from the current Chunk / Region size
+    void _Internal_UpdateDividers();
+
     // Save World Properties - must be called AFTER _Internal_Init
     fBool _Internal_SaveWorldProp();
 
@@ -448,16 +1129,239 @@ protected:
     // ----------------------------------------------------------------------------
     // Internal Chunk Related Functions
 
+    // Return the key for chunk position X,Z in ChunkMap
+    static fLong _Internal_GetChunkKey(fInt IN_X, fInt IN_Z) { return (fLong)(((uint64_t)(fUInt)IN_X << 32) | (fUInt)IN_Z); }
+
     // Return the Index for chunk at position X,Z if found, F_UINT_MAX otherwise
     fUInt _Internal_GetChunkIndex(fInt IN_X, fInt IN_Z);
 
+    // Same as above but without the "LastChunkIndex" cache - Safe to call from several threads at once
+    fVoxelChunk* _Internal_FindChunk(fInt IN_X, fInt IN_Z) const;
+
+    // Casts the rays [IN_Start, IN_End) of a "RaycastBatch()"
+    void _Internal_RaycastRange(const fVoxelRay* IN_RayList, fVoxelRayHit* OUT_HitList, size_t IN_Start, size_t IN_End);
+
+    // Splits [0, IN_Num) into ranges of at least IN_MinPerThread and calls IN_Func on each from its own thread
+    // The calling thread takes the first range - IN_ThreadNum 0 means one per hardware thread
+    void _Internal_RunBatch(size_t IN_Num, fUInt IN_ThreadNum, size_t IN_MinPerThread, const std::function<void(size_t, size_t)>& IN_Func);
+
+    // Return true if any voxel in the inclusive global range is solid
+    // Voxels in chunks not loaded count as solid, voxels above / below the world do not
+    fBool _Internal_GetisRangeSolid(fInt IN_MinX, fInt IN_MinY, fInt IN_MinZ, fInt IN_MaxX, fInt IN_MaxY, fInt IN_MaxZ);
+
+    // Moves the box REF_Min / REF_Max along IN_Axis (0 = X, 1 = Y, 2 = Z) by up to IN_Delta and return the distance moved
+    fFloat _Internal_SweepAxis(fUInt IN_Axis, fFloat* REF_Min, fFloat* REF_Max, fFloat IN_Delta);
+
+    // Writes a single voxel and records the change - Return false if BlockList allocation failed
+    fBool _Internal_SetChunkVoxel(fUInt IN_ChunkIndex, fInt IN_LocalX, fInt IN_LocalY, fInt IN_LocalZ, fUInt IN_BlockID);
+
+    // Marks the sections touching the local box (inclusive) as modified and mesh dirty
+    // Sections of neighbour chunks are marked mesh dirty if the box touches the chunk border
+    void _Internal_MarkDirty(fUInt IN_ChunkIndex, fInt IN_MinX, fInt IN_MinY, fInt IN_MinZ, fInt IN_MaxX, fInt IN_MaxY, fInt IN_MaxZ);
+
+    // Writes IN_BlockID into the global box (inclusive), split by chunk. Chunks not loaded are skipped
+    //      @ IN_ReplaceID - Only voxels holding this ID are written (F_VOXEL_EDIT_ANY = every voxel)
+    //      @ IN_SphereRadius - If >= 0, only voxels within this distance of the box center are written
+    // Return false if a BlockList allocation failed
+    fBool _Internal_EditBox(fInt IN_MinX, fInt IN_MinY, fInt IN_MinZ, fInt IN_MaxX, fInt IN_MaxY, fInt IN_MaxZ, fUInt IN_BlockID, fUInt IN_ReplaceID, fInt IN_SphereRadius);
+
+    // Writes a single X row [IN_MinX, IN_MaxX] (local) of a chunk - Return true if any voxel changed
+    fBool _Internal_EditRow(fVoxelChunk* IN_Chunk, fUInt IN_MinX, fUInt IN_MaxX, fUInt IN_Y, fUInt IN_Z, fUInt IN_BlockID, fUInt IN_ReplaceID);
+
+    // Marks every section of the neighbours of the chunk as mesh dirty (and the diagonal chunks with ambient occlusion)
+    void _Internal_MarkNeighboursDirty(fVoxelChunk* IN_Chunk);
+
+    // Return the chunk diagonal to IN_Chunk through the neighbour links - nullptr if not loaded
+    //      @ IN_Corner - bit 0: X+ (else X-), bit 1: Z+ (else Z-)
+    fVoxelChunk* _Internal_GetDiagonal(fVoxelChunk* IN_Chunk, fUInt IN_Corner);
+
+    // Scans every column of the chunk for its heights - see "fVoxelChunk::SolidHeightList"
+    void _Internal_BuildHeightmap(fVoxelChunk* IN_Chunk);
+
+    // Rebuilds what direct writes to the BlockList left out of date - see "fVoxelChunk::isHeightmapDirty"
+    void _Internal_RefreshChunkData(fVoxelChunk* IN_Chunk);
+
+    // Updates the heights of the columns of an edited box - Columns are only scanned down from the box if it reached their top
+    void _Internal_UpdateHeightmap(fVoxelChunk* IN_Chunk, fInt IN_MinX, fInt IN_MinZ, fInt IN_MaxX, fInt IN_MaxY, fInt IN_MaxZ);
+
+    // Scans TopHeightList for the highest non Air voxel Y of the chunk, -1 if all Air - see "fVoxelChunk::MaxHeight"
+    fInt _Internal_GetMaxHeight(fVoxelChunk* IN_Chunk);
+
+    // Counts every voxel of the sections [IN_MinSection, IN_MaxSection] - see "fVoxelSection::SolidBits"
+    void _Internal_BuildOccupancy(fVoxelChunk* IN_Chunk, fUInt IN_MinSection = 0, fUInt IN_MaxSection = F_UINT_MAX);
+
+    // Moves a single voxel from IN_OldID to IN_NewID in the occupancy of its section
+    void _Internal_CountVoxel(fVoxelChunk* IN_Chunk, fUInt IN_X, fUInt IN_Y, fUInt IN_Z, fUInt IN_OldID, fUInt IN_NewID);
+
+    // Bit of the voxel in "fVoxelSection::SolidBits"
+    fUInt _Internal_GetSectionBit(fUInt IN_X, fUInt IN_Y, fUInt IN_Z) {
+        if (IndexShift_Y >= 0) { return ((IN_Y % F_VOXEL_SECTION_SIZE_Y) << IndexShift_Y) | (IN_Z << IndexShift_Z) | IN_X; }
+        return (((IN_Y % F_VOXEL_SECTION_SIZE_Y) * ChunkSize_Z) + IN_Z) * ChunkSize_X + IN_X;
+    }
+
+    // Return true if the section can not have any visible face - Opaque all around it, or all Air
+    fBool _Internal_GetisSectionHidden(fVoxelChunk* IN_Chunk, fUInt IN_SectionIndex);
+
+    // Return the light byte of a voxel - IN_X / IN_Z may be one voxel outside of the chunk (read from the neighbour)
+    // Above the chunk is full sky light, below is dark. Neighbours not lit yet return full sky light
+    fUChar _Internal_GetLight(fVoxelChunk* IN_Chunk, fInt IN_X, fInt IN_Y, fInt IN_Z);
+
+    // Light byte of a voxel inside a lit chunk
+    fUChar& _Internal_GetLightRef(fVoxelChunk* IN_Chunk, fUInt IN_X, fUInt IN_Y, fUInt IN_Z) {
+        fUInt Section = IN_Y / F_VOXEL_SECTION_SIZE_Y;
+        fUInt LocalY = IN_Y % F_VOXEL_SECTION_SIZE_Y;
+        return IN_Chunk->SectionList[Section].LightList[(((LocalY * ChunkSize_Z) + IN_Z) * ChunkSize_X) + IN_X];
+    }
+
+    // Moves REF_Node one voxel along IN_Dir (fVoxel_FaceAxis order), across chunk borders
+    // Return false if outside of Y bounds or the chunk is not loaded / not lit
+    fBool _Internal_StepLightNode(fVoxelLightNode& REF_Node, fUInt IN_Dir);
+
+    // Fills the section LightLists of a chunk - Sky light down the columns and block light from the emitters
+    // Light is then spread to (and from) the lit neighbours. Does nothing if already lit
+    void _Internal_InitChunkLight(fVoxelChunk* IN_Chunk);
+
+    // Queues the voxels of the lit neighbours touching the chunk with a light level above 0
+    void _Internal_QueueBorderLight(fVoxelChunk* IN_Chunk, fUInt IN_Shift);
+
+    // Recomputes the light of every voxel in the box after an edit - Called from "_Internal_MarkDirty()"
+    void _Internal_RelightBox(fVoxelChunk* IN_Chunk, fInt IN_MinX, fInt IN_MinY, fInt IN_MinZ, fInt IN_MaxX, fInt IN_MaxY, fInt IN_MaxZ);
+
+    // Runs the removal queue of a single channel - Darkens the voxels lit by the removed light (two queue removal)
+    // Brighter voxels met on the way are pushed to the add queue to fill the gap again
+    //      @ IN_Shift - 4 for Sky light, 0 for Block light
+    void _Internal_RemoveLight(fUInt IN_Shift);
+
+    // Runs the add queue of a single channel - Light spreads to non opaque voxels, one level less per voxel
+    void _Internal_SpreadLight(fUInt IN_Shift);
+
+    // Marks the meshes seeing the light of a voxel as dirty
+    void _Internal_MarkLightDirty(fVoxelChunk* IN_Chunk, fUInt IN_X, fUInt IN_Y, fUInt IN_Z);
+
+    // Clears the light of every chunk - Lit again on the next mesh generation
+    void _Internal_ResetLight();
+
+    // Fills LightScratch for the section, see "_Internal_GatherSection()"
+    void _Internal_GatherSectionLight(fUInt IN_ChunkIndex, fUInt IN_SectionIndex);
+
+    // Links the chunk with its loaded neighbours (both ways) / removes those links
+    void _Internal_LinkNeighbours(fVoxelChunk* IN_Chunk);
+    void _Internal_UnlinkNeighbours(fVoxelChunk* IN_Chunk);
+
+    // Rebuilds "BlockRegistry" from VoxelList and the texture steps
+    void _Internal_UpdateRegistry();
+
+    // Marks every section of every chunk as mesh dirty - Used when the mesh output format changes
+    void _Internal_MarkAllMeshDirty();
+
+    // Return a packed copy of a face mesh, vertex positions snapped to the voxel corners
+    fProcMesh _Internal_PackFaceMesh(const fProcMesh& REF_Mesh, fUInt IN_Face);
+
+    // Return false (and logs) if the chunk size does not fit the current mesh output format
+    fBool _Internal_ValidateMeshFormat();
+
+    // Appends the mesh of a single section to the mesh of each voxel's render pass (or IN_Sink if not nullptr)
+    //      @ OUT_PassList - F_VOXEL_PASS_NUM meshes, may point to the same mesh
+    // Return the number of visible voxels, F_UINT_MAX if IN_Sink ran out of space
+    fUInt _Internal_GenerateSectionMesh(fUInt IN_ChunkIndex, fUInt IN_SectionIndex, fProcMesh* const* OUT_PassList, fVoxelMeshSink* IN_Sink = nullptr);
+
+    // Generates the whole chunk into OUT_PassList (see "_Internal_GenerateSectionMesh()")
+    fBool _Internal_GenerateChunkMesh(fUInt IN_ChunkIndex, fProcMesh* const* OUT_PassList);
+
+    // Shared start of every full chunk mesh generation - Lits the chunk on its first mesh
+    //      @ OUT_isEmpty - true if the chunk is all Air and there is nothing to generate
+    fBool _Internal_PrepareChunkMesh(fUInt IN_ChunkIndex, fBool& OUT_isEmpty);
+
+    // Generates the dirty section meshes of a chunk - see "UpdateChunkMesh()"
+    fBool _Internal_UpdateSectionMeshes(fUInt IN_ChunkIndex);
+
+    // Builds REF_Mesh from the section meshes of a pass (F_UINT_MAX = every pass, one after the other)
+    // If REF_Mesh is still what the last call for the same chunk and pass left in it, only the section meshes
+    // generated since are replaced - see "fVoxelSpliceState"
+    void _Internal_SpliceSectionMeshes(fVoxelChunk* IN_Chunk, fUInt IN_Pass, fProcMesh& REF_Mesh);
+
+    // Forgets the output mesh of REF_State - Its next splice builds the mesh from scratch
+    void _Internal_ResetSpliceState(fVoxelSpliceState& REF_State);
+
+    // Copies the float channels of REF_Mesh into REF_Sink - Return false if the sink ran out of space
+    fBool _Internal_WriteSink(fVoxelMeshSink& REF_Sink, const fProcMesh& REF_Mesh);
+
+    // Return the face meshes matching the current output format (indexed / packed)
+    const fProcMesh* _Internal_GetFaceMeshes();
+
+    // Copies the Block IDs of a section into "MeshScratch" with a one voxel border around it
+    // The border is copied from the voxels above / below and the 4 neighbour chunks (Air if not loaded)
+    // Layout is Y > Z > X, each axis padded by 1 - see "MeshPad_X", "MeshPad_Z"
+    const fUInt* _Internal_GatherSection(fUInt IN_ChunkIndex, fUInt IN_SectionIndex);
+
+    // Copies the X row at local Y,Z of a chunk into OUT_Row (ChunkSize_X entries)
+    void _Internal_CopyRow(fVoxelChunk* IN_Chunk, fUInt IN_Y, fUInt IN_Z, fUInt* OUT_Row);
+
+    // Return the Index into a BlockList for a local position based on VoxelLayout, F_UINT_MAX if out of bounds
+    fUInt _Internal_GetVoxelIndex(fUInt IN_X, fUInt IN_Y, fUInt IN_Z) {
+        if (IN_X >= ChunkSize_X) { return F_UINT_MAX; }
+        if (IN_Y >= ChunkSize_Y) { return F_UINT_MAX; }
+        if (IN_Z >= ChunkSize_Z) { return F_UINT_MAX; }
+
+        if (VoxelLayout == F_VOXEL_LAYOUT_BRICK) { return _Internal_GetBrickVoxelIndex(IN_X, IN_Y, IN_Z); }
+
+        // X > Z > Y
+        if (IndexShift_Y >= 0) { return (IN_Y << IndexShift_Y) | (IN_Z << IndexShift_Z) | IN_X; }
+        return (IN_Y * (ChunkSize_Z * ChunkSize_X)) + (IN_Z * ChunkSize_X) + IN_X;
+    }
+
+    // F_VOXEL_LAYOUT_BRICK part of "_Internal_GetVoxelIndex()" - No bounds check
+    fUInt _Internal_GetBrickVoxelIndex(fUInt IN_X, fUInt IN_Y, fUInt IN_Z);
+
+    // Return the local position for an Index into a BlockList based on VoxelLayout
+    fVector3ui _Internal_GetVoxelPosition(fUInt IN_Index);
+
     // Return the index for the first empty chunk, or F_UINT_MAX if no such chunk found
+    // Grows the chunk pool if there is no empty chunk and the pool is not at its max size
     fUInt _Internal_GetEmptyChunk();
 
+    // ----------------------------------------------------------------------------
+    // Chunk Pool Functions
+
+    // Return the current time in milliseconds - used for BlockList idle times
+    static fLong _Internal_GetTimeMS();
+
+    // Return the effective Min / Max number of chunks in the pool
+    fUInt _Internal_GetPoolMinChunks();
+    fUInt _Internal_GetPoolMaxChunks();
+
+    // Adds a new slab of chunks to ChunkList. Return false if the pool is already at its max size
+    fBool _Internal_GrowChunkPool();
+
+    // Return a BlockList filled with F_UINT_MAX
+    // Reuses a cached BlockList if any, allocates a new one otherwise
+    // Return NULLPTR if the memory budget does not allow a new allocation
+    fUInt* _Internal_AcquireBlockList();
+
+    // Gives back a BlockList to the cache
+    void _Internal_ReleaseBlockList(fUInt* IN_BlockList);
+
+    // Deallocates cached BlockLists released before IN_Time (in milliseconds)
+    // Return the number of bytes deallocated
+    fLong _Internal_FreeCachedBlockLists(fLong IN_Time);
+
     // ----------------------------------------------------------------------------
     // Mesh Stuff
 
-    fBool _Internal_GenerateVoxel(fUInt IN_ChunkIndex, fUInt IN_BlockIndex, fVoxelLocalPos IN_Pos, fProcMesh& OUT_Mesh);
+    // Return the ambient occlusion (0-3) of the 4 corners of a face, 2 bits each - Corner is (U sign | V sign << 1)
+    // Two faces can only be merged into one quad if their keys are equal
+    //      @ IN_Face - 0-5, see "VoxelMesh"
+    fUInt _Internal_GetFaceAO(const fUInt* IN_Padded, fUInt IN_PadIndex, fUInt IN_Face);
+
+    // Bakes ambient occlusion into the vertices [IN_Start, end) of REF_Mesh, added for IN_Face of the voxel at IN_PadIndex
+    //      @ IN_IndexStart - First index of the face in REF_Mesh (indexed meshes only)
+    void _Internal_ApplyFaceAO(const fUInt* IN_Padded, fUInt IN_PadIndex, fUInt IN_Face, fProcMesh& REF_Mesh, fUInt IN_Start, fUInt IN_IndexStart);
+
+    // Appends the faces of a single voxel to OUT_Mesh - Return true if any face generated
+    //      @ IN_Padded - Section volume from "_Internal_GatherSection()"
+    //      @ IN_PadIndex - Index of the voxel in IN_Padded
+    //      @ IN_FaceMesh - Face meshes to use, 7 entries (see "_Internal_GetFaceMeshes()")
+    fBool _Internal_GenerateVoxel(const fUInt* IN_Padded, fUInt IN_PadIndex, fVoxelLocalPos IN_Pos, const fProcMesh* IN_FaceMesh, fProcMesh& OUT_Mesh);
 public:
     // -----------------------------------
 
@@ -482,7 +1386,8 @@ public:
     fBool SaveChunk(fUInt IN_ChunkIndex);
 
     // Unloads the chunk data from memory and marks chunk as non existing
-    fBool UnloadChunk(fUInt IN_ChunkIndex, fBool IN_isSave = true);
+    // Chunks held by a ticket (see "AcquireChunk()") are only unloaded if IN_isForce is set
+    fBool UnloadChunk(fUInt IN_ChunkIndex, fBool IN_isSave = true, fBool IN_isForce = false);
 
     // Return a pointer to the specified chunk or NULLPTR if invalid Index
     fVoxelChunk* GetChunkPtr(fUInt IN_ChunkIndex);
@@ -493,41 +1398,181 @@ public:
     // Unloads all chunks and Wolrd
     fBool UnloadWorld();
 
+    // Keeps all chunks within IN_Radius of chunk position X,Z loaded until the ticket is released
+    // Chunks not yet loaded are spawned
+    //      @ IN_PosX - Global Chunk Position X
+    //      @ IN_PosZ - Global Chunk Position Z
+    //      @ IN_Level - One of F_CHUNK_TICKET_LEVEL_*
+    //      @ IN_Radius - Number of chunks around X,Z to hold (0 = only the chunk at X,Z)
+    // Return the Ticket ID or F_UINT_MAX on failure
+    fUInt AcquireChunk(fInt IN_PosX, fInt IN_PosZ, fUInt IN_Level = F_CHUNK_TICKET_LEVEL_FULL, fUInt IN_Radius = 0);
+
+    // Releases a ticket returned by "AcquireChunk()"
+    // Chunks no longer held by any ticket are scheduled to be saved and unloaded by "UpdateChunkTickets()"
+    fBool ReleaseChunk(fUInt IN_TicketID);
+
+    // Saves and unloads chunks whose last ticket has been released
+    //      @ IN_MaxUnloads - Max number of chunks to unload in this call, the rest remain scheduled
+    // Return the number of chunks unloaded
+    fUInt UpdateChunkTickets(fUInt IN_MaxUnloads = F_UINT_MAX);
+
+    // Deallocates BlockLists idle for longer than the idle time and shrinks the pool towards its min size
+    // Expected to be called periodically (e.g. once per frame / tick)
+    fBool UpdateChunkPool();
+
 
     // ----------------------------------
     fBool SetVoxelMesh(std::vector<fProcMesh> IN_MeshList);
     void UseDefaultVoxelMesh();
-    void SetTextureSteps(fFloat IN_StepX, fFloat IN_StepY) { TextureStep_X = IN_StepX; TextureStep_Y = IN_StepY; }
-    void SetVoxelList(std::vector<fVoxelBlock> IN_BlockList) { VoxelList = IN_BlockList; }
+    // Generate indexed chunk meshes (see "fProcMesh::Indices") - Identical vertices of each face are merged
+    void SetIndexedMesh(fBool IN_isIndexed);
+    // Generate packed chunk meshes (see "fVoxelPackedVertex") - Chunk size must fit in F_VOXEL_PACKED_MAX_*
+    // Face meshes are expected to have their vertices on the voxel corners and UVs on the tile corners (as "UseDefaultVoxelMesh()")
+    void SetPackedMesh(fBool IN_isPacked);
+    // Bake per vertex ambient occlusion (see "fProcMesh::AO") from the voxels around each face corner
+    // Quads are split along the diagonal that keeps the occlusion gradient smooth
+    void SetAmbientOcclusion(fBool IN_isAmbientOcclusion);
+    // Keep per voxel sky and block light (4 bits each) and emit it as vertex colours (see "fProcMesh::Colors")
+    // Chunks are lit on their first mesh generation (or "LightChunk()"), then kept up to date by edits
+    // Sky light passes through non opaque blocks without loss going down, block light comes from "F_VOXEL_BLOCK_LIGHT_*"
+    void SetLighting(fBool IN_isLighting);
+    // Lits the chunk now instead of on its first mesh generation - Return false if not loaded or lighting is disabled
+    fBool LightChunk(fUInt IN_ChunkIndex);
+    // Unpacks a vertex generated with "SetPackedMesh(true)" - Normal is the first normal of the face mesh
+    void UnpackVertex(const fVoxelPackedVertex& REF_Vertex, fVector3& OUT_Position, fVector3& OUT_Normal, fVector2& OUT_UV);
+    void SetTextureSteps(fFloat IN_StepX, fFloat IN_StepY);
+    void SetVoxelList(std::vector<fVoxelBlock> IN_BlockList);
     void SetVoxelSize(fFloat IN_X, fFloat IN_Y, fFloat IN_Z) { VoxelSize_X = IN_X; VoxelSize_Y = IN_Y; VoxelSize_Z = IN_Z; }
     // ----------------------------------
     fVoxelLocalPos GetVoxelLocalPos(fInt IN_GlobalX, fInt IN_GlobalY, fInt IN_GlobalZ);
     fVoxelGlobalPos GetVoxelGlobalPos(fVoxelLocalPos IN_Pos);
+
+    // Converts IN_Num global positions at once
+    void GetVoxelLocalPos(const fVoxelGlobalPos* IN_PosList, fVoxelLocalPos* OUT_PosList, size_t IN_Num);
+
+    // Converts IN_Num global X,Z coordinates at once, stored as separate arrays (SIMD when available)
+    // Y is not affected by the conversion so it is not part of it
+    void GetVoxelLocalPos(const fInt* IN_GlobalX, const fInt* IN_GlobalZ, fInt* OUT_ChunkX, fInt* OUT_ChunkZ, fInt* OUT_LocalX, fInt* OUT_LocalZ, size_t IN_Num);
     fUInt GetVoxelIndex(fInt IN_X, fInt IN_Y, fInt IN_Z);
+    // Looks up IN_Num voxels at once - Same result as GetVoxelIndex() for each position
+    // Chunks are resolved once per call through a small cache (F_VOXEL_GET_VOXELS_CACHE entries)
+    // Runs along X within a row are copied in one go (F_VOXEL_LAYOUT_LINEAR only)
+    void GetVoxels(const fVoxelGlobalPos* IN_PosList, fUInt* OUT_BlockList, size_t IN_Num);
 
+    // Faces are ordered by render pass (opaque, cutout, translucent) - Same output as "UpdateChunkMesh()"
     fBool GenerateChunkMesh(fUInt IN_ChunkIndex, fProcMesh& OUT_Mesh);
 
+    // Generates one mesh per render pass (F_VOXEL_PASS_*) - Pass of a block is set by its Flags
+    // Opaque geometry can then be drawn first (front to back), and translucent geometry last
+    fBool GenerateChunkMesh(fUInt IN_ChunkIndex, fProcMesh OUT_MeshList[F_VOXEL_PASS_NUM]);
+
+    // Same as above but writes the vertices straight into caller owned buffers - see "fVoxelMeshSink"
+    // Always non-indexed, non-packed float output
+    fBool GenerateChunkMesh(fUInt IN_ChunkIndex, fVoxelMeshSink& REF_Sink);
+
+    // Same as "GenerateChunkMesh()" but keeps the mesh of each section in the chunk
+    // Only sections changed since the last call (see "fVoxelSection::isMeshDirty") are generated again
+    // If OUT_Mesh is the mesh given to the last call for this chunk and has not been changed since,
+    // only those sections are replaced in it - Otherwise OUT_Mesh is rebuilt from the section meshes
+    // OUT_Mesh holds every render pass one after the other (opaque first)
+    fBool UpdateChunkMesh(fUInt IN_ChunkIndex, fProcMesh& OUT_Mesh);
+    fBool UpdateChunkMesh(fUInt IN_ChunkIndex, fProcMesh OUT_MeshList[F_VOXEL_PASS_NUM]);
+
+    // Return the mesh kept for a single section and render pass by "UpdateChunkMesh()" - nullptr if index out of bounds
+    fProcMesh* GetSectionMesh(fUInt IN_ChunkIndex, fUInt IN_SectionIndex, fUInt IN_Pass = F_VOXEL_PASS_OPAQUE);
+
+    // Sets / Gets / Clears a single Voxel at global position X,Y,Z
+    // Changes are recorded per chunk (for saving) and per section (for meshing)
+    // Return false if the chunk is not loaded or Y is out of bounds
+    // GetVoxel also returns false for Air
     fBool SetVoxel(fInt IN_X, fInt IN_Y, fInt IN_Z, fVoxelBlock& REF_Voxel);
+    fBool SetVoxel(fInt IN_X, fInt IN_Y, fInt IN_Z, fUInt IN_BlockID);
     fBool GetVoxel(fInt IN_X, fInt IN_Y, fInt IN_Z, fVoxelBlock& OUT_Voxel);
     fBool ClearVoxel(fInt IN_X, fInt IN_Y, fInt IN_Z);
+    // Highest solid (or non Air if IN_isSolid is false) voxel Y of the column, -1 if none
+    // Return false if the chunk is not loaded
+    fBool GetHeight(fInt IN_X, fInt IN_Z, fInt& OUT_Height, fBool IN_isSolid = true);
+    // Rebuilds the heightmap of a chunk - Done on its own before the next mesh or "GetHeight()" of a chunk written directly
+    // (see "fVoxelChunk::isHeightmapDirty"), so only needed if BlockList has been written without "fVoxelChunk::AllocateBlockList()"
+    fBool UpdateChunkHeightmap(fUInt IN_ChunkIndex);
+    // Rebuilds the section occupancy of a chunk - Done on its own before the next mesh or section query of a chunk written directly
+    // (see "fVoxelChunk::isOccupancyDirty"), so only needed if BlockList has been written without "fVoxelChunk::AllocateBlockList()"
+    fBool UpdateChunkOccupancy(fUInt IN_ChunkIndex);
+    // Number of voxels with IN_BlockID (F_UINT_MAX for Air) in a section - Return false if the section does not exist
+    fBool GetSectionBlockCount(fUInt IN_ChunkIndex, fUInt IN_SectionIndex, fUInt IN_BlockID, fUInt& OUT_Count);
+    // Return true if the section is all Air / all solid - false as well if the section does not exist
+    fBool GetisSectionEmpty(fUInt IN_ChunkIndex, fUInt IN_SectionIndex);
+    fBool GetisSectionFull(fUInt IN_ChunkIndex, fUInt IN_SectionIndex);
+    // Appends the position of every IN_BlockID voxel within IN_Radius of X,Y,Z to OUT_PosList
+    // Sections without the block are skipped without reading their voxels
+    fBool FindBlocks(fInt IN_X, fInt IN_Y, fInt IN_Z, fUInt IN_Radius, fUInt IN_BlockID, std::vector<fVoxelGlobalPos>& OUT_PosList);
+    // Return false if the chunk is not loaded or not lit yet
+    fBool GetLight(fInt IN_X, fInt IN_Y, fInt IN_Z, fUInt& OUT_SkyLight, fUInt& OUT_BlockLight);
+    // ----------------------------------
+    // Bulk edits - Edits are split by chunk and dirty state is recorded once per chunk
+    // Positions are global and bounds inclusive. Voxels in chunks not loaded (or outside of Y bounds) are skipped
+    // Return false if the world is not initialised or a BlockList could not be allocated
+    fBool FillBox(fInt IN_MinX, fInt IN_MinY, fInt IN_MinZ, fInt IN_MaxX, fInt IN_MaxY, fInt IN_MaxZ, fUInt IN_BlockID);
+    fBool FillSphere(fInt IN_CenterX, fInt IN_CenterY, fInt IN_CenterZ, fInt IN_Radius, fUInt IN_BlockID);
+    fBool FillColumn(fInt IN_X, fInt IN_Z, fInt IN_MinY, fInt IN_MaxY, fUInt IN_BlockID);
+    fBool FillLayer(fInt IN_Y, fInt IN_MinX, fInt IN_MinZ, fInt IN_MaxX, fInt IN_MaxZ, fUInt IN_BlockID);
+    // Writes IN_ToID into every voxel of the box currently holding IN_FromID
+    fBool ReplaceInBox(fInt IN_MinX, fInt IN_MinY, fInt IN_MinZ, fInt IN_MaxX, fInt IN_MaxY, fInt IN_MaxZ, fUInt IN_FromID, fUInt IN_ToID);
+    // Applies IN_Num single voxel writes. Later edits of the same voxel win
+    fBool ApplyEdits(const fVoxelEdit* IN_EditList, size_t IN_Num);
+    // ----------------------------------
+    // Walks the voxels along the ray (Amanatides & Woo DDA) and return the first non Air voxel
+    // Stops after IN_MaxDistance (world units), when leaving the Y bounds or at a chunk not loaded
+    // Thread safe as long as no chunk is edited, spawned or unloaded meanwhile
+    fVoxelRayHit Raycast(fVector3 IN_Origin, fVector3 IN_Direction, fFloat IN_MaxDistance);
+    // Casts IN_Num rays into OUT_HitList, split over IN_ThreadNum threads (0 = one per hardware thread)
+    void RaycastBatch(const fVoxelRay* IN_RayList, fVoxelRayHit* OUT_HitList, size_t IN_Num, fUInt IN_ThreadNum = 0);
+    // ----------------------------------
+    // Moves IN_Box by IN_Delta and slides it along the solid voxels in the way (Y first, then X, then Z)
+    // Only the voxels the box sweeps through are tested - Chunks not loaded count as solid
+    // Thread safe as long as no chunk is edited, spawned or unloaded meanwhile
+    fVoxelSweepResult SweepAABB(const fVoxelAABB& IN_Box, fVector3 IN_Delta);
+    // Sweeps IN_Num boxes into OUT_ResultList, split over IN_ThreadNum threads (0 = one per hardware thread)
+    void SweepAABBBatch(const fVoxelAABB* IN_BoxList, const fVector3* IN_DeltaList, fVoxelSweepResult* OUT_ResultList, size_t IN_Num, fUInt IN_ThreadNum = 0);
     // ----------------------------------
     fBool SetChunkVoxelSize(fInt IN_X, fInt IN_Y, fInt IN_Z);
     fBool SetRegionSize(fInt IN_X, fInt IN_Z);
     fBool SetWorldSize(fInt IN_X, fInt IN_Z);
+    fBool SetVoxelLayout(fUInt IN_Layout);
+    // ----------------------------------
+    // Chunk pool limits - can be changed on the fly
+    //      @ IN_MinChunks - Number of chunks always kept in the pool (0 = "WorldSize_X*WorldSize_Z")
+    //      @ IN_MaxChunks - Number of chunks the pool can grow to (0 = "WorldSize_X*WorldSize_Z")
+    //      @ IN_MemoryBudget - Max number of bytes used by BlockLists (0 = no limit)
+    fBool SetChunkPoolLimits(fUInt IN_MinChunks, fUInt IN_MaxChunks, fLong IN_MemoryBudget = 0);
+    void SetChunkPoolIdleTime(fFloat IN_Seconds) { ChunkPool_IdleTime = IN_Seconds; }
+    fBool SetChunkPoolSlabSize(fUInt IN_SlabSize);
     // ----------------------------------
     void SetMemoryAllocator(fMemoryAllocator IN_Allocator, fMemoryDeAllocator IN_DeAllocator) { Allocator = IN_Allocator; DeAllocator = IN_DeAllocator; }
+    // Allocate BlockLists from one region reserved up front instead of "Allocator" - must be called before world init
+    //      @ IN_SlotCount - Number of BlockLists the region holds (0 = max size of the chunk pool). "Allocator" is used once full
+    //      @ IN_isHugePages - Back the region with huge pages (MAP_HUGETLB, or transparent huge pages if not available)
+    fBool EnableBlockArena(fUInt IN_SlotCount = 0, fBool IN_isHugePages = false);
+    fVoxelArenaStats GetBlockArenaStats() { return BlockArena.GetStats(); }
     void SetLogCallback(fLogCallback IN_LogCallback) { Log_FunctionPtr = IN_LogCallback; }
     void SetMinimumLogLevel(fUChar IN_MinSeverity) { Log_MinLevel = IN_MinSeverity; }
     // ----------------------------------
     fBool GetisInited() { return isInit; }
     fVector3ui GetChunkSize() { return {ChunkSize_X, ChunkSize_Y, ChunkSize_Z}; }
+    fUInt GetVoxelLayout() { return VoxelLayout; }
     fVector3 GetVoxelSize() { return {VoxelSize_X, VoxelSize_Y, VoxelSize_Z}; }
     fProcMesh* GetFoxelMeshArray() { return &VoxelMesh[0]; }
+    const fVoxelBlockRegistry& GetBlockRegistry() { return BlockRegistry; }
+    fBool GetisIndexedMesh() { return isIndexedMesh; }
+    fBool GetisPackedMesh() { return isPackedMesh; }
+    fBool GetisAmbientOcclusion() { return isAmbientOcclusion; }
+    fBool GetisLighting() { return isLighting; }
 
     // ----------------------------------
     // Getters
     fLong Get_ChunksPerWorld() { return ChunksPerWorld; }
     fLong Get_BlocksPerChunk() { return BlocksPerChunk; }
+    fLong Get_ChunkPoolBytes() { return ChunkPool_AllocatedBytes; }
 
     // ----------------------------------
     // Give access to IO / Log funtions
@@ -535,3 +1580,99 @@ public:
     friend class fVoxelRegionData;
 };
 
+
+
+// Inlined so lookups from outside the library get the same shift / mask fast path
+inline fUInt fVoxelChunk::GetVoxelIndex(fUInt IN_X, fUInt IN_Y, fUInt IN_Z) {
+    return WorldPtr->_Internal_GetVoxelIndex(IN_X, IN_Y, IN_Z);
+}
+
+
+// ----------------------------------------------------------------------------------------------------
+// Compile Time Sized World
+// ----------------------------------------------------------------------------------------------------
+
+// Voxel World with the number of voxels per chunk fixed at compile time
+// Index math and global <-> local conversion are done on constants, so power of 2 sizes reduce to shifts and masks
+// Always uses F_VOXEL_LAYOUT_LINEAR - Everything else behaves the same as fVoxelWorld
+// Size and layout are locked: SetChunkVoxelSize() / SetVoxelLayout() / LoadWorld() fail for anything else
+// NOTE: Lookups are hidden, not overriden - calls through a fVoxelWorld pointer / reference use the runtime versions (same result)
+// Internal paths (meshing, bulk edits, raycasts, GetVoxels) use the runtime math, which takes the same shift / mask
+// path for power of 2 sizes (see "fVoxelWorld::IndexShift_Y") - The template only saves the checks of that path
+template<fUInt SX, fUInt SY, fUInt SZ>
+class fVoxelWorldT : public fVoxelWorld {
+    static_assert(SX > 0 && SY > 0 && SZ > 0, "fVoxelWorldT chunk size must be > 0");
+public:
+    static constexpr fUInt Size_X = SX;
+    static constexpr fUInt Size_Y = SY;
+    static constexpr fUInt Size_Z = SZ;
+    static constexpr fLong Volume = (fLong)SX * SY * SZ;
+
+    static constexpr fBool isPow2(fUInt IN_Value) { return (IN_Value & (IN_Value - 1)) == 0; }
+    static constexpr fUInt Log2(fUInt IN_Value) { return IN_Value <= 1 ? 0 : 1 + Log2(IN_Value >> 1); }
+
+    // Floor division / modulo by a chunk size - Correct for negative values
+    template<fUInt S> static inline fInt FloorDiv(fInt IN_Value) {
+        if constexpr (isPow2(S)) { return IN_Value >> Log2(S); }
+        else {
+            fInt Result = IN_Value / (fInt)S;
+            if ((IN_Value % (fInt)S) < 0) { Result--; }
+            return Result;
+        }
+    }
+    template<fUInt S> static inline fInt FloorMod(fInt IN_Value) {
+        if constexpr (isPow2(S)) { return IN_Value & (fInt)(S - 1); }
+        else {
+            fInt Result = IN_Value % (fInt)S;
+            if (Result < 0) { Result += S; }
+            return Result;
+        }
+    }
+
+    // Return the Index into BlockList for a local position - No bounds check
+    static constexpr fUInt GetVoxelIndexT(fUInt IN_X, fUInt IN_Y, fUInt IN_Z) {
+        return (IN_Y * (SZ * SX)) + (IN_Z * SX) + IN_X;
+    }
+
+    // Return the Block ID at a local position of IN_Chunk - No bounds check
+    static inline fUInt GetBlockT(fVoxelChunk* IN_Chunk, fUInt IN_X, fUInt IN_Y, fUInt IN_Z) {
+        return IN_Chunk->GetBlock(GetVoxelIndexT(IN_X, IN_Y, IN_Z));
+    }
+
+    fVoxelWorldT() {
+        ChunkSize_X = SX;
+        ChunkSize_Y = SY;
+        ChunkSize_Z = SZ;
+        VoxelLayout = F_VOXEL_LAYOUT_LINEAR;
+        isLayoutLocked = true;
+        _Internal_UpdateDividers();
+    }
+
+    fVoxelLocalPos GetVoxelLocalPos(fInt IN_GlobalX, fInt IN_GlobalY, fInt IN_GlobalZ) {
+        fVoxelLocalPos Result;
+        Result.ChunkX = FloorDiv<SX>(IN_GlobalX);
+        Result.ChunkZ = FloorDiv<SZ>(IN_GlobalZ);
+        Result.LocalX = FloorMod<SX>(IN_GlobalX);
+        Result.LocalY = IN_GlobalY;
+        Result.LocalZ = FloorMod<SZ>(IN_GlobalZ);
+        return Result;
+    }
+
+    fVoxelGlobalPos GetVoxelGlobalPos(fVoxelLocalPos IN_Pos) {
+        fVoxelGlobalPos Result;
+        Result.GlobalX = (IN_Pos.ChunkX * (fInt)SX) + IN_Pos.LocalX;
+        Result.GlobalY = IN_Pos.LocalY;
+        Result.GlobalZ = (IN_Pos.ChunkZ * (fInt)SZ) + IN_Pos.LocalZ;
+        return Result;
+    }
+
+    // Return the Block ID at the global position or F_UINT_MAX if not loaded / out of bounds
+    fUInt GetVoxelIndex(fInt IN_X, fInt IN_Y, fInt IN_Z) {
+        if ((fUInt)IN_Y >= SY) { return F_UINT_MAX; }
+
+        fUInt CIndex = _Internal_GetChunkIndex(FloorDiv<SX>(IN_X), FloorDiv<SZ>(IN_Z));
+        if (CIndex == F_UINT_MAX) { return F_UINT_MAX; }
+
+        return GetBlockT(ChunkList[CIndex], FloorMod<SX>(IN_X), IN_Y, FloorMod<SZ>(IN_Z));
+    }
+};